@@ -0,0 +1,47 @@
+#include "AllocStats.h"
+
+AllocStats::Slot AllocStats::s_slots[(int)AllocTag::Count];
+thread_local AllocTag AllocStats::t_current = AllocTag::Other;
+
+AllocCounters AllocStats::Get(AllocTag tag)
+{
+	const Slot& slot = s_slots[(int)tag];
+	return
+	{
+		slot.allocs.load(std::memory_order_relaxed),
+		slot.frees.load(std::memory_order_relaxed),
+		slot.bytes.load(std::memory_order_relaxed),
+		slot.freedBytes.load(std::memory_order_relaxed)
+	};
+}
+
+AllocCounters AllocStats::Total()
+{
+	AllocCounters total = {};
+	for (int i = 0; i < (int)AllocTag::Count; i++)
+	{
+		AllocCounters c = Get(AllocTag(i));
+		total.allocs += c.allocs;
+		total.frees += c.frees;
+		total.bytes += c.bytes;
+		total.freedBytes += c.freedBytes;
+	}
+	return total;
+}
+
+AllocTag AllocStats::Current()
+{
+	return t_current;
+}
+
+const char* AllocStats::TagName(AllocTag tag)
+{
+	switch (tag)
+	{
+	case AllocTag::Font:		return "font";
+	case AllocTag::Workspace:	return "workspace";
+	case AllocTag::Render:		return "render";
+	case AllocTag::Text:		return "text";
+	default:					return "other";
+	}
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+#include <memory>
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "FrameArena.h"
+
+//Allocation accounting for the containers that carry pixels and text.
+//Containers built on TrackedAllocator (bitmap_t rows, text_t) report every
+//allocation and free to the subsystem currently set on the calling thread.
+//Frees are counted where they happen, so live bytes are exact only in total.
+//Allocations served by a FrameArena never reach the heap and are not counted.
+enum class AllocTag
+{
+	Other,
+	Font,		//Font loading, glyph images, font tables
+	Workspace,	//Glyph layer, clipboard
+	Render,		//Render loop buffers, menu and overlays
+	Text,		//String builders
+	Count
+};
+
+struct AllocCounters
+{
+	uint64_t	allocs;
+	uint64_t	frees;
+	uint64_t	bytes;
+	uint64_t	freedBytes;
+};
+
+class AllocStats
+{
+private:
+	struct Slot
+	{
+		std::atomic<uint64_t>	allocs;
+		std::atomic<uint64_t>	frees;
+		std::atomic<uint64_t>	bytes;
+		std::atomic<uint64_t>	freedBytes;
+	};
+
+	static Slot		s_slots[(int)AllocTag::Count];
+	static thread_local AllocTag	t_current;
+
+	friend class AllocScope;
+
+public:
+	static void OnAlloc(size_t bytes)
+	{
+		Slot& slot = s_slots[(int)t_current];
+		slot.allocs.fetch_add(1, std::memory_order_relaxed);
+		slot.bytes.fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	static void OnFree(size_t bytes)
+	{
+		Slot& slot = s_slots[(int)t_current];
+		slot.frees.fetch_add(1, std::memory_order_relaxed);
+		slot.freedBytes.fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	static AllocCounters Get(AllocTag tag);
+	static AllocCounters Total();
+	static AllocTag Current();
+	static const char* TagName(AllocTag tag);
+};
+
+//Attributes allocations of the calling thread to a subsystem until the end of the scope
+class AllocScope
+{
+private:
+	AllocTag	_prev;
+
+	AllocScope(AllocScope&) = delete;
+	AllocScope& operator=(AllocScope&) = delete;
+
+public:
+	AllocScope(AllocTag tag) : _prev(AllocStats::t_current) { AllocStats::t_current = tag; }
+	~AllocScope() { AllocStats::t_current = _prev; }
+};
+
+template<class T>
+struct TrackedAllocator
+{
+	using value_type = T;
+
+	TrackedAllocator() noexcept {}
+	template<class U>
+	TrackedAllocator(const TrackedAllocator<U>&) noexcept {}
+
+	T* allocate(size_t n)
+	{
+		if (FrameArena* arena = FrameArena::Transient())
+			return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+
+		AllocStats::OnAlloc(n * sizeof(T));
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T* p, size_t n) noexcept
+	{
+		FrameArena* arena = FrameArena::Bound();
+		if (arena && arena->Owns(p))
+			return;	//Rewound with the frame
+
+		AllocStats::OnFree(n * sizeof(T));
+		std::allocator<T>().deallocate(p, n);
+	}
+
+	template<class U>
+	bool operator==(const TrackedAllocator<U>&) const noexcept { return true; }
+	template<class U>
+	bool operator!=(const TrackedAllocator<U>&) const noexcept { return false; }
+};
+
+using text_t = std::basic_string<char, std::char_traits<char>, TrackedAllocator<char>>;
\ No newline at end of file
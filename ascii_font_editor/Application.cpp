@@ -1,10 +1,13 @@
 #include "Application.h"
 #include "Font.h"
+#include "FontIO.h"
 #include "version.h"
 #include "FontTestWindow.h"
 #include <thread>
 #include <sstream>
+#include <algorithm>
 #include "reutils.h"
+#include "Trace.h"
 
 #define IDC_NEWWND						200
 #define IDC_COLUMNS						201
@@ -41,32 +44,39 @@ void Application::_testFont()
 	
 	_testThread = std::make_unique<std::thread>([this]()
 	{
-		auto str = _makeFontDict();
-		std::vector<unsigned char> dict;
-		for (char c : str)
-			dict.push_back(c);
-		FontTestWindow
-		(
-			Font(
+		TRACE_THREAD("preview");
+		TRACE_SCOPE("_testThread");
+		Font font = [this]()
+		{
+			std::lock_guard<std::mutex> guard(_fontLock);
+			auto str = _makeFontDict();
+			std::vector<unsigned char> dict;
+			for (char c : str)
+				dict.push_back(c);
+			return Font(
 				dict,
 				_chH,
 				_chW,
 				_fontInterval,
 				_fontSeq
-			),
+			);
+		}();
+		FontTestWindow
+		(
+			font,
 			_testingFont,
 			"The quick brown fox jumps over the lazy dog.",
 			"     ,   , .",
 			"1 2 3 4 5 6 7 8 9 0 123 456 7890",
 			"\" ' ~{ } ` [ | ] !?.,:; @#$%^&*-_=+ ( ) \\ / < >"
 		);
-		str.clear();
 	});
 }
 
 
 void MenuEvent(Canvas& canv, Canvas::MenuButtons btn)
 {
+	TRACE_SCOPE("MenuEvent");
 	std::vector<unsigned char> dict;
 	std::string str;
 	std::thread t;
@@ -122,6 +132,29 @@ bool CloseEvent(Canvas& canv)
 	return true;
 }
 
+//Every running editor owns an autosave slot through an exclusive lock file held until it exits.
+//A slot that can be locked belongs to no running editor, files left in it are from a session that crashed.
+static const int s_autosaveSlots = 16;
+
+static HANDLE lockAutosaveBase(std::string& base)
+{
+	char dir[MAX_PATH];
+	DWORD len = GetTempPathA(MAX_PATH, dir);
+	std::string temp(dir, len > 0 && len < MAX_PATH ? len : 0);
+	for (int i = 0; i < s_autosaveSlots; i++)
+	{
+		std::string candidate = temp + "fonted_autosave" + (i > 0 ? "_" + std::to_string(i) : "");
+		HANDLE lock = CreateFileA((candidate + ".lock").c_str(), GENERIC_WRITE, 0, NULL, OPEN_ALWAYS,
+			FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, NULL);
+		if (lock != INVALID_HANDLE_VALUE)
+		{
+			base = candidate;
+			return lock;
+		}
+	}
+	return INVALID_HANDLE_VALUE;
+}
+
 Application::Application()
 	: _columns(32)
 	, _scale(5)
@@ -130,63 +163,125 @@ Application::Application()
 	, _chH(11)
 	, _fontInterval(0)
 	, _testingFont(false)
+	, _io([this](double progress) { if (_canvas) _canvas->SetProgress(progress); })
+	, _autosaveLock(INVALID_HANDLE_VALUE)
 {
 	Font font = Font::makeEmptyFont(_chH, _chW, _chars);
-	auto fbmp = font.getFontTable(_columns);
 	_fontSeq.resize(_chars);
 	for (utf8char_t i = 0; i < (utf8char_t)_chars; i++)
 		_fontSeq[i] = i;
+
+	//Files left behind mean the previous session did not exit cleanly
+	_autosaveLock = lockAutosaveBase(_autosaveBase);
+	if (!_autosaveBase.empty() && Autosave::Recover(_autosaveBase, font))
+	{
+		if (MessageBoxA(NULL, "The previous session ended unexpectedly.\nRestore its unsaved glyphs?", "Recovery", MB_YESNO | MB_ICONQUESTION) == IDYES)
+		{
+			_fontSeq = font.GetAllSupportedChars();
+			_chars = (int)_fontSeq.size();
+			_chW = font.GetWidth();
+			_chH = font.GetHeight();
+			_fontInterval = font.GetInterval();
+		}
+		else
+		{
+			Autosave::Discard(_autosaveBase);
+			font = Font::makeEmptyFont(_chH, _chW, _chars);
+		}
+	}
+
+	auto fbmp = font.getFontTable(_columns);
 	_canvas = std::make_unique<Canvas>(int(fbmp[0].size()), int(fbmp.size()), _scale, (std::string("Pixel Font Editor ") + VERSION + " by Goshante").c_str(), false, 0xFFFFFF00);
 	_canvas->SetOwner(this);
-	_canvas->SetPicture(fbmp);
+	_canvas->SetPicture(fbmp, _chH, _chW, _chars);
 	_canvas->SetCanvasCallback(&MouseEvent);
 	_canvas->SetMenuCallback(&MenuEvent);
 	_canvas->SetCloseCallback(&CloseEvent);
+
+	if (!_autosaveBase.empty())
+	{
+		_autosave = std::make_unique<Autosave>(_autosaveBase,
+			[this](std::vector<int>& cells, std::vector<uint8_t>& bits) { return _canvas->TakeDirtyCells(cells, bits); },
+			[this](uint32_t& generation) { return _snapshotFont(generation); });
+	}
 }
 Application::~Application()
 {
 	_testingFont = false;
 	if (_testThread)
 		_testThread->join();
+
+	_autosave.reset();
+	if (_autosaveLock != INVALID_HANDLE_VALUE)
+		CloseHandle(_autosaveLock);
 }
 
+//Blocks until a key event or a window state change arrives
 bool Application::ProcessEventLoop()
 {
-	if (!_canvas->IsClosed())
-	{
-		if (_canvas->ReinitReady())
-			_canvas->DoReinit();
-		if (GetAsyncKeyState(VK_UP) & 0x01)
-			_canvas->MovePoint(0, 1);
+	InputEvent ev;
+	_canvas->WaitInput(ev);
 
-		if (GetAsyncKeyState(VK_DOWN) & 0x01)
-			_canvas->MovePoint(0, -1);
-
-		if (GetAsyncKeyState(VK_LEFT) & 0x01)
-			_canvas->MovePoint(1, 0);
-
-		if (GetAsyncKeyState(VK_RIGHT) & 0x01)
-			_canvas->MovePoint(-1, 0);
+	TRACE_SCOPE("ProcessEventLoop");
+	if (_canvas->IsClosed())
+	{
+		//Clean exit, nothing to recover next time
+		_autosave.reset();
+		if (!_autosaveBase.empty())
+			Autosave::Discard(_autosaveBase);
+		return false;
+	}
 
-		if (GetAsyncKeyState(VK_SPACE) & 0x01)
-			_canvas->Draw(false);
+	if (_canvas->ReinitReady())
+		_canvas->DoReinit();
+	if (ev.type == InputEvent::Type::Key)
+		_processKey(ev);
+	return true;
+}
 
-		if (GetAsyncKeyState(VK_LCONTROL) & 0x01)
-			_canvas->Draw(true);
+//Movement, drawing, undo and redo follow key repeat, toggles and cell operations fire once per press.
+//Shift moves by whole cells, keys held together with Alt or Win are left to the system.
+void Application::_processKey(const InputEvent& ev)
+{
+	if (ev.action == GLFW_RELEASE || (ev.mods & (GLFW_MOD_ALT | GLFW_MOD_SUPER)))
+		return;
 
-		if (GetAsyncKeyState(0x43) & 0x01) //C
-			_canvas->CopyCell(_chH, _chW, _chars);
+	bool press = ev.action == GLFW_PRESS;
+	auto move = [&](int x, int y)
+	{
+		if (ev.mods & GLFW_MOD_SHIFT)
+			_canvas->MoveCell(x, y);
+		else
+			_canvas->MovePoint(x, y);
+	};
 
-		if (GetAsyncKeyState(0x56) & 0x01) //V
-			_canvas->PasteCell(_chH, _chW, _chars);
+	switch (ev.key)
+	{
+	case GLFW_KEY_UP:			move(0, 1); break;
+	case GLFW_KEY_DOWN:			move(0, -1); break;
+	case GLFW_KEY_LEFT:			move(1, 0); break;
+	case GLFW_KEY_RIGHT:		move(-1, 0); break;
+	case GLFW_KEY_SPACE:		_canvas->Draw(false); break;
+	case GLFW_KEY_LEFT_CONTROL:	_canvas->Draw(true); break;
+	case GLFW_KEY_Z:			_canvas->Undo(); break;
+	case GLFW_KEY_Y:			_canvas->Redo(); break;
+	}
 
-		if (GetAsyncKeyState(0x46) & 0x01) //F
-			_canvas->SwitchHelper();
+	if (!press)
+		return;
 
-		return true;
+	switch (ev.key)
+	{
+	case GLFW_KEY_A:			_canvas->SetAnchor(); break;
+	case GLFW_KEY_C:			_canvas->CopyCells(); break;
+	case GLFW_KEY_V:			_canvas->PasteCells(); break;
+	case GLFW_KEY_S:			_canvas->SwapCells(); break;
+	case GLFW_KEY_INSERT:		_canvas->FillCells(false); break;
+	case GLFW_KEY_DELETE:		_canvas->FillCells(true); break;
+	case GLFW_KEY_F:			_canvas->SwitchHelper(); break;
+	case GLFW_KEY_P:			_canvas->SwitchStats(); break;
+	case GLFW_KEY_ESCAPE:		_io.Cancel(); break;
 	}
-
-	return false;
 }
 
 static std::string calcCharSequenceString(std::string seq)
@@ -435,16 +530,18 @@ bool Application::_createWorkspace(HWND hwnd, const std::string& sequence, int c
 
 	try
 	{
+		Font emptyFont = Font::makeEmptyFont(h, w, count, sequence);
+		auto pic = emptyFont.getFontTable(col);
+
+		std::lock_guard<std::mutex> guard(_fontLock);
 		_scale = scale;
 		_chars = count;
 		_columns = col;
 		_chH = h;
 		_chW = w;
 		_fontInterval = interval;
-		Font emptyFont = Font::makeEmptyFont(h, w, count, sequence);
 		_fontSeq = emptyFont.GetAllSupportedChars();
-		auto pic = emptyFont.getFontTable(col);
-		_canvas->ReInit(pic, (int)pic[0].size(), (int)pic.size(), scale);
+		_canvas->ReInit(pic, (int)pic[0].size(), (int)pic.size(), scale, h, w, count);
 	}
 	catch (const std::exception& ex)
 	{
@@ -455,10 +552,12 @@ bool Application::_createWorkspace(HWND hwnd, const std::string& sequence, int c
 	return true;
 }
 
-std::string Application::_makeFontDict()
+text_t Application::_makeFontDict()
 {
+	AllocScope scope(AllocTag::Text);
 	auto font = _canvas->GetPicture();
-	std::string str;
+	text_t str;
+	str.reserve(size_t(_chars) * _chW * _chH);
 	int cc = 0;
 	for (size_t y = 0; y < font.size(); y += _chH + 1)
 	{
@@ -472,10 +571,7 @@ std::string Application::_makeFontDict()
 				for (size_t xx = 0; xx < _chW; xx++)
 				{
 					pixel_t px = font[y + yy][x + xx];
-					if (px == 0)
-						str += "0";
-					else
-						str += "1";
+					str.push_back(px == 0 ? '0' : '1');
 				}
 			}
 			cc++;
@@ -484,91 +580,121 @@ std::string Application::_makeFontDict()
 	return str;
 }
 
-void Application::_saveFont(const std::string& path)
+//Glyph layer and font parameters consistent with each other.
+//Only the packed copy is made under the locks, the full font is built from it afterwards.
+FontSnapshot Application::_snapshotGlyphs(uint32_t& generation)
 {
-	std::stringstream ss;
-	ss << _chW << "x" << _chH << "\n";
-	std::vector<std::string> intervals;
+	FontSnapshot snapshot;
+	std::lock_guard<std::mutex> guard(_fontLock);
+	if (_canvas->ReinitReady())
+		throw std::runtime_error("The workspace is being replaced, try again");
 
-	auto ch2hex = [](utf8char_t ch) -> std::string
+	generation = _canvas->ReadPicture([&](const bitmap_t& table, const CellGeometry& geom)
 	{
-		char buf[32];
-		sprintf_s(buf, sizeof(buf), "0x%X", ch);
-		return buf;
-	};
+		snapshot.packed = packGlyphTable(table, geom);
+		snapshot.width = geom.CellWidth();
+		snapshot.height = geom.CellHeight();
+		snapshot.count = geom.Count();
+	});
+	snapshot.seq = _fontSeq;
+	snapshot.interval = _fontInterval;
+	snapshot.utf8 = std::any_of(snapshot.seq.begin(), snapshot.seq.end(), [](utf8char_t ch) { return ch > 255; });
+	return snapshot;
+}
 
-	utf8char_t prev;
-	size_t start = 0;
-	for (size_t i = 0; i < _fontSeq.size(); i++)
+Font Application::_snapshotFont(uint32_t& generation)
+{
+	return _makeFont(_snapshotGlyphs(generation));
+}
+
+Font Application::_makeFont(const FontSnapshot& snapshot)
+{
+	auto seq = snapshot.seq;
+	return Font::makeFromBits(unpackGlyphBits(snapshot.packed.data(), snapshot.count, snapshot.width, snapshot.height),
+		snapshot.height, snapshot.width, snapshot.interval, std::move(seq), snapshot.utf8);
+}
+
+//The glyph layer is packed here, encoding and writing run on the I/O worker.
+//Text and packed fonts are written straight from the packed copy, the other formats need a Font.
+//The font goes to a temporary file first, a failed or cancelled save leaves the old file intact.
+void Application::_saveFont(const std::string& path)
+{
+	FontFormat format = FontFormat::Text;
+	size_t dot = path.find_last_of('.');
+	if (dot != std::string::npos)
 	{
-		auto ch = _fontSeq[i];
-		if (i == 0)
-		{
-			prev = ch;
-			continue;
-		}
+		std::string ext = path.substr(dot + 1);
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+		fontFormatFromName(ext, format);
+	}
 
-		if (ch - prev != 1)
+	uint32_t generation;
+	auto snapshot = std::make_shared<FontSnapshot>(_snapshotGlyphs(generation));
+	std::string temp = path + ".part";
+
+	bool queued = _io.Submit("save", [snapshot, path, temp, format](IoTask& task)
+	{
+		try
 		{
-			size_t end = i - 1;
-			if (end - start > 0)
-			{
-				std::stringstream sstr;
-				sstr << _fontSeq[start] << "-" << _fontSeq[end];
-				intervals.push_back(sstr.str());
-			}
+			auto progress = [&task](uint64_t done, uint64_t total) { task.Report(done, total); };
+			if (format == FontFormat::Text || format == FontFormat::Packed)
+				savePackedGlyphs(temp, snapshot->packed.data(), snapshot->count, snapshot->width, snapshot->height,
+					snapshot->interval, snapshot->seq, snapshot->utf8, format, progress);
 			else
-				intervals.push_back(ch2hex(_fontSeq[start]));
-			start = i;
-
-			if (i == _fontSeq.size() - 1)
-				intervals.push_back(ch2hex(ch));
+				saveFont(temp, _makeFont(*snapshot), format, progress);
+			task.Check();
 		}
-		else if (i == _fontSeq.size() - 1)
+		catch (...)
 		{
-			size_t end = i;
-			std::stringstream sstr;
-			sstr << _fontSeq[start] << "-" << _fontSeq[end];
-			intervals.push_back(sstr.str());
+			DeleteFileA(temp.c_str());
+			throw;
 		}
-		prev = ch;
-	}
 
-	ss << "[";
-	for (size_t i = 0; i < intervals.size(); i++)
+		if (!MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING))
+		{
+			DeleteFileA(temp.c_str());
+			throw std::runtime_error("Failed to replace " + path);
+		}
+	},
+	[](IoWorker::Result result, const std::string& error)
 	{
-		if (i > 0)
-			ss << ", ";
-		ss << intervals[i];
-	}
-	ss << "]\n" << "i" << _fontInterval << "\n";
-	
-	ss << _makeFontDict();
-
-	HANDLE hFile = CreateFileA(path.c_str(), GENERIC_WRITE,
-		FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
-
-	if (hFile == NULL || hFile == INVALID_HANDLE_VALUE)
-		throw std::runtime_error("Failed to open font file");
+		if (result == IoWorker::Result::Failed)
+			MessageBoxA(NULL, error.c_str(), "Font save failed", MB_OK | MB_ICONERROR);
+	});
 
-	DWORD dwWritten = 0;
-	auto str = ss.str();
-	if (!WriteFile(hFile, &str[0], (DWORD)str.length(), &dwWritten, NULL))
-	{
-		CloseHandle(hFile);
-		throw std::runtime_error("Failed to write file");
-	}
-	CloseHandle(hFile);
+	if (!queued)
+		throw std::runtime_error("Another file operation is in progress");
 }
 
+//Reading and parsing run on the I/O worker, the new workspace is swapped in by Canvas::ReInit
+//at a frame boundary once everything is ready, a cancelled load leaves the editor untouched
 void Application::_loadFont(const std::string& path)
 {
-	Font font(path);
-	bitmap_t table = font.getFontTable(_columns);
-	_fontSeq = font.GetAllSupportedChars();
-	_chars = (int)_fontSeq.size();
-	_chW = font.GetWidth();
-	_chH = font.GetHeight();
-	_fontInterval = font.GetInterval();
-	_canvas->ReInit(table, (int)table[0].size(), (int)table.size(), _scale);
+	bool queued = _io.Submit("load", [this, path](IoTask& task)
+	{
+		Font font = loadFont(path, [&task](uint64_t done, uint64_t total) { task.Report(done, total); });
+		int columns;
+		{
+			std::lock_guard<std::mutex> guard(_fontLock);
+			columns = _columns;
+		}
+		bitmap_t table = font.getFontTable(columns);
+		task.Check();
+
+		std::lock_guard<std::mutex> guard(_fontLock);
+		_fontSeq = font.GetAllSupportedChars();
+		_chars = (int)_fontSeq.size();
+		_chW = font.GetWidth();
+		_chH = font.GetHeight();
+		_fontInterval = font.GetInterval();
+		_canvas->ReInit(table, (int)table[0].size(), (int)table.size(), _scale, _chH, _chW, _chars);
+	},
+	[](IoWorker::Result result, const std::string& error)
+	{
+		if (result == IoWorker::Result::Failed)
+			MessageBoxA(NULL, error.c_str(), "Font open failed", MB_OK | MB_ICONERROR);
+	});
+
+	if (!queued)
+		throw std::runtime_error("Another file operation is in progress");
 }
\ No newline at end of file
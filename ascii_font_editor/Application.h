@@ -4,11 +4,27 @@
 #include <memory>
 #include <atomic>
 #include <thread>
+#include <mutex>
 #include "Canvas.h"
 #include "Utils.h"
+#include "WinUtils.h"
+#include "IoWorker.h"
+#include "Autosave.h"
 
 class FontTestWindow;
 
+//Glyph layer and font parameters taken together, glyphs packed one bit per pixel
+struct FontSnapshot
+{
+	std::vector<unsigned char>	packed;
+	std::vector<utf8char_t>		seq;
+	int							width = 0;
+	int							height = 0;
+	int							interval = 0;
+	size_t						count = 0;
+	bool						utf8 = false;
+};
+
 class Application
 {
 private:
@@ -22,6 +38,11 @@ private:
 	std::vector<utf8char_t> _fontSeq;
 	std::atomic<bool> _testingFont;
 	std::unique_ptr<std::thread> _testThread;
+	std::mutex _fontLock;	//Font parameters above, shared with the I/O worker and the preview thread
+	IoWorker _io;
+	std::unique_ptr<Autosave> _autosave;
+	std::string _autosaveBase;	//Empty when every autosave slot is taken by other editors
+	HANDLE _autosaveLock;
 
 	Application(Application&) = delete;
 	Application& operator=(Application&) = delete;
@@ -36,7 +57,11 @@ private:
 	bool _createWorkspace(HWND hwnd, const std::string& sequence, int col, int h, int w, int interval, int count, int scale);
 	void _saveFont(const std::string& path);
 	void _loadFont(const std::string& path);
-	std::string _makeFontDict();
+	text_t _makeFontDict();
+	FontSnapshot _snapshotGlyphs(uint32_t& generation);
+	Font _snapshotFont(uint32_t& generation);
+	static Font _makeFont(const FontSnapshot& snapshot);
+	void _processKey(const InputEvent& ev);
 
 public:
 	Application();
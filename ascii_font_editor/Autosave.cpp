@@ -0,0 +1,175 @@
+#include "Autosave.h"
+#include "FontIO.h"
+#include "ImageWriter.h"
+#include <algorithm>
+#include <cstdio>
+
+Autosave::Autosave(const std::string& base, CollectFn collect, SnapshotFn snapshot, std::chrono::milliseconds interval)
+	: _base(base)
+	, _collect(collect)
+	, _snapshot(snapshot)
+	, _interval(interval)
+	, _slot(-1)
+	, _sequence(0)
+	, _generation(0)
+	, _compactSize(0)
+	, _stop(false)
+{
+	//Continue after the newest pair on disk, it stays untouched until the first checkpoint replaces it
+	for (int slot = 0; slot < 2; slot++)
+	{
+		EditJournal::Header header;
+		if (EditJournal::ReadHeader(JournalPath(_base, slot), header) && (_slot < 0 || header.sequence > _sequence))
+		{
+			_slot = slot;
+			_sequence = header.sequence;
+		}
+	}
+
+	_thread = std::thread(&Autosave::_run, this);
+}
+
+Autosave::~Autosave()
+{
+	{
+		std::lock_guard<std::mutex> guard(_lock);
+		_stop = true;
+	}
+	_signal.notify_one();
+	_thread.join();
+
+	try
+	{
+		_journal.Close();
+	}
+	catch (const std::exception&)
+	{
+	}
+}
+
+void Autosave::_run()
+{
+	std::unique_lock<std::mutex> guard(_lock);
+	while (!_signal.wait_for(guard, _interval, [this]() { return _stop; }))
+	{
+		guard.unlock();
+		try
+		{
+			_tick();
+		}
+		catch (const std::exception&)
+		{
+			//The journal may be incomplete now, the next tick starts over with a checkpoint
+			try
+			{
+				_journal.Close();
+			}
+			catch (const std::exception&)
+			{
+			}
+		}
+		guard.lock();
+	}
+}
+
+void Autosave::_tick()
+{
+	uint32_t generation = _collect(_cells, _bits);
+	if (!_journal.IsOpen() || generation != _generation)
+	{
+		_checkpoint();
+		return;
+	}
+
+	if (_cells.empty())
+		return;
+
+	size_t cellBytes = _bits.size() / _cells.size();
+	for (size_t i = 0; i < _cells.size(); i++)
+		_journal.Append(_cells[i], &_bits[i * cellBytes]);
+	_journal.Flush();
+
+	if (_journal.GetSize() > _compactSize)
+		_checkpoint();
+}
+
+void Autosave::_checkpoint()
+{
+	uint32_t generation = 0;
+	Font font = _snapshot(generation);
+	int slot = _slot == 0 ? 1 : 0;
+
+	//A journal left in the slot belongs to an older checkpoint, it must not outlive the new one
+	_journal.Close();
+	remove(JournalPath(_base, slot).c_str());
+	std::vector<unsigned char> packed = encodeFont(font, FontFormat::Packed);
+	writeFile(CheckpointPath(_base, slot), packed);
+	int count = int(font.GetBits().size() / (size_t(font.GetWidth()) * font.GetHeight()));
+	_journal.Create(JournalPath(_base, slot), { ++_sequence, font.GetWidth(), font.GetHeight(), count });
+
+	if (_slot >= 0)
+	{
+		remove(JournalPath(_base, _slot).c_str());
+		remove(CheckpointPath(_base, _slot).c_str());
+	}
+
+	_slot = slot;
+	_generation = generation;
+	_compactSize = Max(uint64_t(packed.size()), uint64_t(64 * 1024));
+}
+
+std::string Autosave::CheckpointPath(const std::string& base, int slot)
+{
+	return base + "." + std::to_string(slot) + ".fntb";
+}
+
+std::string Autosave::JournalPath(const std::string& base, int slot)
+{
+	return base + "." + std::to_string(slot) + ".journal";
+}
+
+bool Autosave::Recover(const std::string& base, Font& font)
+{
+	struct Candidate
+	{
+		int			slot;
+		uint32_t	sequence;
+	};
+
+	std::vector<Candidate> candidates;
+	for (int slot = 0; slot < 2; slot++)
+	{
+		EditJournal::Header header;
+		if (EditJournal::ReadHeader(JournalPath(base, slot), header))
+			candidates.push_back({ slot, header.sequence });
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) { return a.sequence > b.sequence; });
+
+	for (auto& c : candidates)
+	{
+		try
+		{
+			Font checkpoint = loadFont(CheckpointPath(base, c.slot));
+			std::vector<unsigned char> bits = checkpoint.GetBits();
+			EditJournal::Replay(JournalPath(base, c.slot), bits);
+
+			std::vector<utf8char_t> seq = checkpoint.GetSequence();
+			font = Font::makeFromBits(std::move(bits), checkpoint.GetHeight(), checkpoint.GetWidth(), checkpoint.GetInterval(), std::move(seq), checkpoint.IsUTF8());
+			return true;
+		}
+		catch (const std::exception&)
+		{
+			//Damaged pair, try the older one
+		}
+	}
+	return false;
+}
+
+void Autosave::Discard(const std::string& base)
+{
+	for (int slot = 0; slot < 2; slot++)
+	{
+		remove(JournalPath(base, slot).c_str());
+		remove(CheckpointPath(base, slot).c_str());
+	}
+}
\ No newline at end of file
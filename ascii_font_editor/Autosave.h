@@ -0,0 +1,60 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+#include "Font.h"
+#include "EditJournal.h"
+
+//Crash recovery for the editor workspace.
+//Keeps a checkpoint font in the packed format and a journal of the cells changed since.
+//Every interval the changed cells are appended to the journal, so the cost follows the edits.
+//Once the journal outgrows the checkpoint it is compacted into a new checkpoint with a fresh
+//journal in the other of two slots. The old slot is removed only after the new one is complete,
+//a crash at any point leaves at least one intact checkpoint and journal pair.
+class Autosave
+{
+public:
+	//Moves out the cells changed since the last call, returns the workspace generation
+	using CollectFn = std::function<uint32_t(std::vector<int>& cells, std::vector<uint8_t>& bits)>;
+	//Whole font and the workspace generation it was taken from
+	using SnapshotFn = std::function<Font(uint32_t& generation)>;
+
+private:
+	std::string					_base;
+	CollectFn					_collect;
+	SnapshotFn					_snapshot;
+	std::chrono::milliseconds	_interval;
+	EditJournal					_journal;
+	int							_slot;			//Slot of the current pair, -1 before the first checkpoint
+	uint32_t					_sequence;
+	uint32_t					_generation;
+	uint64_t					_compactSize;	//Journal size that triggers a new checkpoint
+	std::vector<int>			_cells;
+	std::vector<uint8_t>		_bits;
+	std::mutex					_lock;
+	std::condition_variable		_signal;
+	bool						_stop;
+	std::thread					_thread;
+
+	Autosave(Autosave&) = delete;
+	Autosave& operator=(Autosave&) = delete;
+
+	void _run();
+	void _tick();
+	void _checkpoint();
+
+public:
+	Autosave(const std::string& base, CollectFn collect, SnapshotFn snapshot, std::chrono::milliseconds interval = std::chrono::seconds(2));
+	~Autosave();
+
+	static std::string CheckpointPath(const std::string& base, int slot);
+	static std::string JournalPath(const std::string& base, int slot);
+	//Newest intact checkpoint with its journal replayed, false if there is nothing to recover
+	static bool Recover(const std::string& base, Font& font);
+	static void Discard(const std::string& base);
+};
\ No newline at end of file
@@ -0,0 +1,376 @@
+#include "BdfFont.h"
+#include "FileReader.h"
+#include <stdexcept>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <map>
+
+static const char s_bdfMagic[] = "STARTFONT";
+
+//Splits an in-memory file the way FileReader does
+class MemoryLines
+{
+private:
+	const char*	_pos;
+	const char*	_end;
+
+public:
+	MemoryLines(const std::vector<unsigned char>& data)
+		: _pos((const char*)data.data())
+		, _end((const char*)data.data() + data.size())
+	{
+	}
+
+	bool ReadLine(std::string& line)
+	{
+		if (_pos == _end)
+			return false;
+
+		const char* nl = (const char*)memchr(_pos, '\n', _end - _pos);
+		const char* stop = nl ? nl : _end;
+		line.assign(_pos, stop);
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		_pos = nl ? nl + 1 : _end;
+		return true;
+	}
+};
+
+//Line starts with the keyword followed by a space or nothing, args points past it
+static bool keyword(const std::string& line, const char* key, const char*& args)
+{
+	size_t len = strlen(key);
+	if (line.compare(0, len, key) != 0 || (line.length() > len && line[len] != ' ' && line[len] != '\t'))
+		return false;
+	args = line.c_str() + len;
+	return true;
+}
+
+static int readInts(const char* args, int* values, int count)
+{
+	int n = 0;
+	for (; n < count; n++)
+	{
+		char* end;
+		long v = strtol(args, &end, 10);
+		if (end == args)
+			break;
+		values[n] = (int)v;
+		args = end;
+	}
+	return n;
+}
+
+static int hexDigit(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+template<class Lines>
+static Font parseBdf(Lines& lines, const std::function<void()>& tick)
+{
+	std::string line;
+	const char* args;
+	if (!lines.ReadLine(line) || !keyword(line, s_bdfMagic, args))
+		throw std::runtime_error("Not a BDF font");
+
+	//Header up to CHARS, the cell has to be known before the first glyph
+	int fbb[4] = {};
+	bool hasBox = false;
+	int fontAscent = -1, fontDescent = -1;
+	bool unicode = false;
+	size_t declared = 0;
+	for (;;)
+	{
+		if (!lines.ReadLine(line))
+			throw std::runtime_error("BDF font has no glyphs");
+
+		if (keyword(line, "FONTBOUNDINGBOX", args))
+			hasBox = readInts(args, fbb, 4) == 4;
+		else if (keyword(line, "FONT_ASCENT", args))
+			readInts(args, &fontAscent, 1);
+		else if (keyword(line, "FONT_DESCENT", args))
+			readInts(args, &fontDescent, 1);
+		else if (keyword(line, "CHARSET_REGISTRY", args))
+			unicode = strstr(args, "ISO10646") != nullptr || strstr(args, "iso10646") != nullptr;
+		else if (keyword(line, "CHARS", args))
+		{
+			int n = 0;
+			readInts(args, &n, 1);
+			declared = n > 0 ? (size_t)n : 0;
+			break;
+		}
+	}
+
+	if (!hasBox || fbb[0] <= 0 || fbb[1] <= 0)
+		throw std::runtime_error("BDF font has no valid FONTBOUNDINGBOX");
+
+	int ascent = Max(fontAscent, fbb[1] + fbb[3]);
+	int descent = Max(fontDescent, -fbb[3]);
+	int originX = Max(0, -fbb[2]);
+	int w = originX + fbb[2] + fbb[0];
+	int h = ascent + descent;
+	if (w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF)
+		throw std::runtime_error("Invalid font resolution");
+
+	size_t glyphBits = size_t(w) * h;
+	std::vector<unsigned char> bits;
+	std::vector<uint32_t> codes;
+	bits.reserve(Min(declared, (size_t)1 << 20) * glyphBits);
+	codes.reserve(Min(declared, (size_t)1 << 20));
+	uint32_t maxCode = 0;
+	std::map<int, size_t> gaps;	//How many glyphs advance this far past the cell
+
+	long encoding = -1;
+	int dwidth = -1;
+	int bbx[4] = {};
+	bool inChar = false;
+	for (size_t n = 0; lines.ReadLine(line); n++)
+	{
+		if ((n & 0xFFF) == 0 && tick)
+			tick();
+
+		if (keyword(line, "STARTCHAR", args))
+		{
+			inChar = true;
+			encoding = -1;
+			dwidth = -1;
+			bbx[0] = bbx[1] = bbx[2] = bbx[3] = 0;
+		}
+		else if (!inChar)
+		{
+			if (keyword(line, "ENDFONT", args))
+				break;
+		}
+		else if (keyword(line, "ENCODING", args))
+			encoding = strtol(args, nullptr, 10);
+		else if (keyword(line, "DWIDTH", args))
+			readInts(args, &dwidth, 1);
+		else if (keyword(line, "BBX", args))
+		{
+			if (readInts(args, bbx, 4) != 4 || bbx[0] < 0 || bbx[1] < 0)
+				throw std::runtime_error("Invalid BBX in BDF glyph");
+		}
+		else if (keyword(line, "BITMAP", args))
+		{
+			//Rows go straight into the cell, top row first, clipped to the cell
+			size_t start = bits.size();
+			bool keep = encoding >= 0;
+			if (keep)
+				bits.resize(start + glyphBits, 0);
+
+			int top = ascent - bbx[3] - bbx[1];
+			int left = originX + bbx[2];
+			for (int r = 0; r < bbx[1]; r++)
+			{
+				if (!lines.ReadLine(line))
+					throw std::runtime_error("BDF glyph bitmap is truncated");
+				if (!keep)
+					continue;
+
+				int y = top + r;
+				if ((int)line.length() * 4 < bbx[0])
+					throw std::runtime_error("BDF bitmap row is too short");
+				if (y < 0 || y >= h)
+					continue;
+
+				unsigned char* dst = &bits[start + size_t(y) * w];
+				for (int c = 0; c < bbx[0]; c++)
+				{
+					int digit = hexDigit(line[c >> 2]);
+					if (digit < 0)
+						throw std::runtime_error("Invalid hex digit in BDF bitmap");
+					int x = left + c;
+					if (x >= 0 && x < w && ((digit >> (3 - (c & 3))) & 1))
+						dst[x] = 1;
+				}
+			}
+
+			if (keep)
+			{
+				codes.push_back((uint32_t)encoding);
+				maxCode = Max(maxCode, (uint32_t)encoding);
+				if (dwidth >= w)
+					gaps[dwidth - w]++;
+			}
+		}
+		else if (keyword(line, "ENDCHAR", args))
+			inChar = false;
+	}
+
+	if (codes.empty())
+		throw std::runtime_error("BDF font has no encoded glyphs");
+
+	bool utf8 = unicode || maxCode > 255;
+	std::vector<utf8char_t> seq(codes.size());
+	for (size_t i = 0; i < codes.size(); i++)
+		seq[i] = utf8 ? codepoint_to_utf8char(codes[i]) : codes[i];
+
+	//The interval is the advance past the cell most glyphs share, writeBdf gives every glyph w + interval
+	int interval = 0;
+	size_t votes = 0;
+	for (auto& gap : gaps)
+	{
+		if (gap.second > votes)
+		{
+			interval = gap.first;
+			votes = gap.second;
+		}
+	}
+
+	return Font::makeFromBits(std::move(bits), h, w, interval, std::move(seq), utf8);
+}
+
+bool isBdf(const std::vector<unsigned char>& data)
+{
+	size_t len = sizeof(s_bdfMagic) - 1;
+	return data.size() >= len && memcmp(data.data(), s_bdfMagic, len) == 0;
+}
+
+bool isBdfFile(const std::string& path)
+{
+	FILE* f = fopen(path.c_str(), "rb");
+	if (!f)
+		return false;
+
+	std::vector<unsigned char> head(sizeof(s_bdfMagic) - 1);
+	head.resize(fread(head.data(), 1, head.size(), f));
+	fclose(f);
+	return isBdf(head);
+}
+
+Font readBdf(const std::string& path, const ProgressFn& progress)
+{
+	FileReader reader(path);
+	std::function<void()> tick;
+	if (progress)
+		tick = [&]() { progress(reader.GetConsumed(), reader.GetSize()); };
+
+	Font font = parseBdf(reader, tick);
+	if (progress)
+		progress(reader.GetSize(), reader.GetSize());
+	return font;
+}
+
+Font decodeBdf(const std::vector<unsigned char>& data)
+{
+	MemoryLines lines(data);
+	return parseBdf(lines, nullptr);
+}
+
+//Collects the output of emitBdf in memory
+struct ByteSink
+{
+	std::vector<unsigned char>&	data;
+
+	void Put(char c) { data.push_back((unsigned char)c); }
+	void Write(const void* p, size_t size) { data.insert(data.end(), (const unsigned char*)p, (const unsigned char*)p + size); }
+	void Write(const std::string& str) { Write(str.data(), str.size()); }
+};
+
+template<class Out>
+static void emitBdf(Out& out, const Font& font, const std::string& name, const ProgressFn& progress)
+{
+	int w = font.GetWidth(), h = font.GetHeight();
+	size_t glyphBits = size_t(w) * h;
+	auto& bits = font.GetBits();
+	auto& seq = font.GetSequence();
+	size_t count = bits.size() / glyphBits;
+	bool utf8 = font.IsUTF8();
+
+	//XLFD fields are separated by '-'
+	std::string family;
+	for (char c : name)
+		family.push_back(c == '-' || c == '"' || c == '\n' ? '_' : c);
+
+	char buf[256];
+	out.Write("STARTFONT 2.1\n");
+	snprintf(buf, sizeof(buf), "-fonted-%s-Medium-R-Normal--%d-%d-72-72-C-%d-%s\n", family.c_str(), h, h * 10, w * 10,
+		utf8 ? "ISO10646-1" : "FontSpecific-0");
+	out.Write("FONT ", 5);
+	out.Write(buf, strlen(buf));
+	snprintf(buf, sizeof(buf), "SIZE %d 72 72\nFONTBOUNDINGBOX %d %d 0 0\n", h, w, h);
+	out.Write(buf, strlen(buf));
+	snprintf(buf, sizeof(buf), "STARTPROPERTIES 5\nFONT_ASCENT %d\nFONT_DESCENT 0\nSPACING \"C\"\nCHARSET_REGISTRY \"%s\"\nCHARSET_ENCODING \"%s\"\nENDPROPERTIES\n",
+		h, utf8 ? "ISO10646" : "FontSpecific", utf8 ? "1" : "0");
+	out.Write(buf, strlen(buf));
+	snprintf(buf, sizeof(buf), "CHARS %zu\n", count);
+	out.Write(buf, strlen(buf));
+
+	static const char hex[] = "0123456789ABCDEF";
+	int advance = w + font.GetInterval();
+	for (size_t g = 0; g < count; g++)
+	{
+		uint32_t code = seq.empty() ? (uint32_t)g : (utf8 ? utf8char_to_codepoint(seq[g]) : (uint32_t)seq[g]);
+		if (utf8)
+			snprintf(buf, sizeof(buf), "STARTCHAR U+%04X\nENCODING %u\n", code, code);
+		else
+			snprintf(buf, sizeof(buf), "STARTCHAR char%u\nENCODING %u\n", code, code);
+		out.Write(buf, strlen(buf));
+
+		//Ink box, the baseline is the bottom of the cell
+		const unsigned char* src = &bits[g * glyphBits];
+		int left = w, right = 0, top = h, bottom = 0;
+		for (int y = 0; y < h; y++)
+		{
+			for (int x = 0; x < w; x++)
+			{
+				if (src[y * w + x] == 0)
+					continue;
+				left = Min(left, x);
+				right = Max(right, x + 1);
+				top = Min(top, y);
+				bottom = Max(bottom, y + 1);
+			}
+		}
+		if (right == 0)
+			left = right = top = bottom = 0;
+
+		snprintf(buf, sizeof(buf), "SWIDTH %d 0\nDWIDTH %d 0\nBBX %d %d %d %d\nBITMAP\n", advance * 1000 / h, advance,
+			right - left, bottom - top, left, h - bottom);
+		out.Write(buf, strlen(buf));
+
+		for (int y = top; y < bottom; y++)
+		{
+			const unsigned char* row = src + y * w;
+			for (int x = left; x < right; x += 8)
+			{
+				int byte = 0;
+				for (int b = 0; b < 8 && x + b < right; b++)
+				{
+					if (row[x + b] != 0)
+						byte |= 0x80 >> b;
+				}
+				out.Put(hex[byte >> 4]);
+				out.Put(hex[byte & 0xF]);
+			}
+			out.Put('\n');
+		}
+		out.Write("ENDCHAR\n");
+
+		if (progress && ((g & 0xFFF) == 0xFFF || g + 1 == count))
+			progress(g + 1, count);
+	}
+	out.Write("ENDFONT\n");
+}
+
+void writeBdf(FileWriter& out, const Font& font, const std::string& name, const ProgressFn& progress)
+{
+	emitBdf(out, font, name, progress);
+}
+
+std::vector<unsigned char> encodeBdf(const Font& font, const std::string& name)
+{
+	std::vector<unsigned char> data;
+	ByteSink sink = { data };
+	emitBdf(sink, font, name, nullptr);
+	return data;
+}
\ No newline at end of file
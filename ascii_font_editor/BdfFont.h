@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Font.h"
+#include "FontIO.h"
+#include "FileWriter.h"
+
+//X11 Bitmap Distribution Format 2.1.
+//Glyphs have their own bounding box around the origin, they are placed into the fixed Font cell
+//on a common baseline: the cell spans the font bounding box and the FONT_ASCENT/FONT_DESCENT
+//properties, whichever is larger. The interval is the advance past the cell width that most glyphs
+//share in DWIDTH, other advances have no Font counterpart and are dropped.
+//ISO10646 fonts and fonts with codes past 255 load as UTF-8, others as 8-bit, unencoded glyphs are skipped.
+//Files are parsed line by line as they are read, only the glyph dictionary is kept in memory.
+bool isBdf(const std::vector<unsigned char>& data);
+//True when the file starts like a BDF font, reads only the first line
+bool isBdfFile(const std::string& path);
+Font readBdf(const std::string& path, const ProgressFn& progress = nullptr);
+Font decodeBdf(const std::vector<unsigned char>& data);
+//Glyphs get ink-tight boxes on a baseline at the bottom of the cell
+void writeBdf(FileWriter& out, const Font& font, const std::string& name, const ProgressFn& progress = nullptr);
+std::vector<unsigned char> encodeBdf(const Font& font, const std::string& name);
\ No newline at end of file
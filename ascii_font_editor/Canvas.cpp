@@ -5,8 +5,11 @@
 #define GLFW_EXPOSE_NATIVE_WIN32
 #include <GLFW/glfw3native.h>
 #include "MenuFont.h"
-#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+#include <map>
 #include "resource.h"
+#include "Trace.h"
 
 #define Min(a,b) (a < b ? a : b)
 
@@ -25,23 +28,32 @@ Canvas::Canvas(int w, int h, int scale, const std::string& title, bool startHidd
 	, _pointX(0)
 	, _pointY(0)
 	, _scale(scale)
-	, _doDraw(0)
+	, _stroking(false)
+	, _strokeErase(false)
+	, _strokeX(0)
+	, _strokeY(0)
 	, _cc(false)
 	, _mc(false)
 	, _clc(false)
 	, _useMarker(true)
-	, _menuFont(getMenuFont(), 14, 8, 1)
 	, _menuFrame(w, MenuHeight)
 	, _lastButton(MenuButtons::None)
 	, _lastMenuClick(std::chrono::system_clock::now())
 	, _owner(nullptr)
-	, _holdDraw(false)
-	, _lastDrawCall(std::chrono::system_clock::now())
 	, _initialROPos(0.0f)
 	, _opacity(1.0f)
+	, _anchored(false)
+	, _anchorX(0)
+	, _anchorY(0)
 	, _enableHelper(false)
+	, _statsFrame(1, 1)
+	, _showStats(false)
+	, _lastStatsUpdate()
+	, _lastAllocs()
+	, _lastStatsFrames(0)
+	, _progress(-1)
 {
-	InitBitmap(_frame, _height, _width);
+	_workspace.Reset(_width, _height);
 	if (!_closed)
 		_thread = std::make_shared<std::thread>(&Canvas::_draw, this);
 }
@@ -53,8 +65,23 @@ Canvas::~Canvas()
 
 bitmap_t Canvas::GetPicture() const
 {
-	std::lock_guard<std::mutex> guard(_lock);
-	return _frame;
+	TRACE_LOCK(_lock, "Canvas::_lock");
+	return _workspace.GetPicture();
+}
+
+//Gives the reader the live glyph layer without copying it, edits wait until it returns.
+//Returns the workspace generation the picture belongs to.
+uint32_t Canvas::ReadPicture(const std::function<void(const bitmap_t&, const CellGeometry&)>& reader) const
+{
+	TRACE_LOCK(_lock, "Canvas::_lock");
+	reader(_workspace.GetPicture(), _workspace.GetGeometry());
+	return _workspace.GetGeneration();
+}
+
+uint32_t Canvas::TakeDirtyCells(std::vector<int>& cells, std::vector<uint8_t>& bits)
+{
+	TRACE_LOCK(_lock, "Canvas::_lock");
+	return _workspace.TakeDirtyCells(cells, bits);
 }
 
 void Canvas::Show(const bitmap_t& bmp)
@@ -63,9 +90,19 @@ void Canvas::Show(const bitmap_t& bmp)
 		return;
 
 	if (!bmp.empty())
-		_frame = bmp;
+	{
+		//Keeps the current cell layout
+		const CellGeometry& geom = _workspace.GetGeometry();
+		_workspace.Load(bmp, geom.CellHeight(), geom.CellWidth(), geom.Count());
+	}
 	else
-		InitBitmap(_frame, _height, _width);
+		_workspace.Reset(_width, _height);
+	_start();
+}
+
+void Canvas::_start()
+{
+	_edits.Clear();
 	_closed = false;
 	_thread = std::make_shared<std::thread>(&Canvas::_draw, this);
 }
@@ -79,15 +116,15 @@ void Canvas::Close()
 	_thread->join();
 }
 
-void Canvas::SetPicture(const bitmap_t& picture)
+void Canvas::SetPicture(const bitmap_t& picture, int cellH, int cellW, int count)
 {
-	std::lock_guard<std::mutex> guard(_lock);
-	_frame = picture;
+	TRACE_LOCK(_lock, "Canvas::_lock");
+	_workspace.Load(picture, cellH, cellW, count);
 }
 
 void Canvas::MovePoint(int x, int y)
 {
-	std::lock_guard<std::mutex> guard(_lock);
+	TRACE_LOCK(_lock, "Canvas::_lock");
 
 	if (_lastButton != MenuButtons::None)
 	{
@@ -102,11 +139,31 @@ void Canvas::MovePoint(int x, int y)
 	_pointY = _pointY - y;
 	_pointY = _pointY < 0 ? 0 : _pointY;
 	_pointY = _pointY >= _height ? _height - 1 : _pointY;
+
+	if (_stroking)
+		_strokeTo(_pointX, _pointY);
+}
+
+void Canvas::MoveCell(int x, int y)
+{
+	int stepX = 1, stepY = 1;
+	{
+		TRACE_LOCK(_lock, "Canvas::_lock");
+		const CellGeometry& geom = _workspace.GetGeometry();
+		if (!geom.IsEmpty())
+		{
+			//Cell pitch includes the grid line
+			stepX = geom.CellWidth() + 1;
+			stepY = geom.CellHeight() + 1;
+		}
+	}
+
+	MovePoint(x * stepX, y * stepY);
 }
 
 bool Canvas::SetPoint(int x, int y)
 {
-	std::lock_guard<std::mutex> guard(_lock);
+	TRACE_LOCK(_lock, "Canvas::_lock");
 
 	if (_lastButton != MenuButtons::None)
 	{
@@ -130,30 +187,75 @@ bool Canvas::SetPoint(int x, int y)
 	_pointX = x;
 	_pointY = y - MenuHeight;
 
+	if (_stroking)
+		_strokeTo(_pointX, _pointY);
+
 	return true;
 }
 
 void Canvas::Draw(bool erase, bool hold)
 {
-	Canvas::TimePoint now = std::chrono::system_clock::now();
-	auto now_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(now);
-	auto last_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(_lastDrawCall);
-	bool singleDraw = false;
-	if (now_ms - last_ms < 333ms && !hold)
-		singleDraw = true;
-	_lastDrawCall = now;
-
-	if (_holdDraw && !hold)
+	//Releasing a held button only ends the stroke, its pixels were queued while moving
+	if (_stroking && !hold)
 	{
-		_holdDraw = false;
-		_doDraw = 0;
+		_endStroke();
+		return;
+	}
 
-		if (!singleDraw)
-			return;
+	TRACE_LOCK(_lock, "Canvas::_lock");
+	_strokeErase = erase;
+	{
+		TRACE_LOCK(_editLock, "Canvas::_editLock");
+		_strokeX = _pointX;
+		_strokeY = _pointY;
 	}
+	if (hold && !_stroking.exchange(true))
+		_pushEdit({ EditOp::BeginStroke });
+	_pushEdit({ erase ? EditOp::Erase : EditOp::SetPixel, _pointX, _pointY, _pointX, _pointY });
+}
 
-	_doDraw = erase ? 2 : 1;
-	_holdDraw = hold;
+void Canvas::_endStroke()
+{
+	//The whole stroke becomes one undo entry
+	if (_stroking.exchange(false))
+		_pushEdit({ EditOp::EndStroke });
+}
+
+void Canvas::_strokeTo(int x, int y)
+{
+	//Each cursor sample becomes a segment from the previous one, so fast drags leave no gaps.
+	//The origin is read and advanced together with the push, GLFW callbacks and the application loop both get here.
+	TRACE_LOCK(_editLock, "Canvas::_editLock");
+	if (x == _strokeX && y == _strokeY)
+		return;
+
+	_edits.Push({ EditOp::Line, _strokeX, _strokeY, x, y, _strokeErase });
+	_strokeX = x;
+	_strokeY = y;
+}
+
+void Canvas::_pushEdit(const EditCommand& cmd)
+{
+	//Edits come from GLFW callbacks and from the application loop, keep the queue single producer
+	TRACE_LOCK(_editLock, "Canvas::_editLock");
+	_edits.Push(cmd);
+}
+
+void Canvas::_presentMenu()
+{
+	_menuFrame.Present(*_pw, [](pixel_t px) -> uint32_t
+	{
+		switch (px)
+		{
+		case 1:		return 0xFFFFFFFF;
+		case 2:		return 0xFFFF00FF;
+		case 3:		return 0xFF00FF00;
+		case 4:		return 0x55555555;
+		case 5:		return 0xFFFFD6FF;
+		case 6:		return 0xFFFFAAAA;
+		default:	return 0xFF000044;
+		}
+	}, _scale, _width, MenuHeight);
 }
 
 static void callbackMouse(void* owner, pw::mpos pos, int button, int action, int modes)
@@ -174,8 +276,7 @@ static void callbackMouse(void* owner, pw::mpos pos, int button, int action, int
 		Canvas::MenuButtons btn = Canvas::MenuButtons::None;
 		if (menu && canv->_mc && (button == 0 || button == 1))
 		{
-			canv->_doDraw = 0;
-			canv->_holdDraw = false;
+			canv->_endStroke();
 
 			Canvas::TimePoint now = std::chrono::system_clock::now();
 			auto now_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(now);
@@ -239,7 +340,7 @@ static bool callbackClose(void* owner)
 	Canvas* canv = reinterpret_cast<Canvas*>(owner);
 	if (canv->_clc)
 	{
-		if (canv->_reinit)
+		if (canv->ReinitReady())
 			canv->_closed = true;
 		return canv->_callbackClose(*canv);
 	}
@@ -247,6 +348,24 @@ static bool callbackClose(void* owner)
 	return false;
 }
 
+//GLFW key callbacks only get the window handle, the owner is looked up here
+static std::mutex s_keyTargetsLock;
+static std::map<GLFWwindow*, Canvas*> s_keyTargets;
+
+static void callbackKey(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+	Canvas* canv = nullptr;
+	{
+		std::lock_guard<std::mutex> guard(s_keyTargetsLock);
+		auto it = s_keyTargets.find(window);
+		if (it != s_keyTargets.end())
+			canv = it->second;
+	}
+
+	if (canv && key != GLFW_KEY_UNKNOWN)
+		canv->_input.Push({ InputEvent::Type::Key, key, action, mods });
+}
+
 static void callbackCursor(void* owner, pw::mpos pos)
 {
 	Canvas* canv = reinterpret_cast<Canvas*>(owner);
@@ -276,15 +395,19 @@ void Canvas::_redrawMenu()
 {
 	static bool firstDraw = false;
 	_menuFrame.Clear();
-	auto newDims = _menuFrame.DrawTextRegular(_menuFont, "New", 2, 1, 1, _lastButton == MenuButtons::New);
-	auto openDims = _menuFrame.DrawTextRegular(_menuFont, "Open", 5 + newDims.b_x, 1, 1, _lastButton == MenuButtons::Open);
-	auto saveDims = _menuFrame.DrawTextRegular(_menuFont, "Save", 5 + openDims.b_x, 1, 1, _lastButton == MenuButtons::Save);
+	auto newDims = _menuFrame.DrawTextRegular(s_menuFont, "New", 2, 1, 1, _lastButton == MenuButtons::New);
+	auto openDims = _menuFrame.DrawTextRegular(s_menuFont, "Open", 5 + newDims.b_x, 1, 1, _lastButton == MenuButtons::Open);
+	auto saveDims = _menuFrame.DrawTextRegular(s_menuFont, "Save", 5 + openDims.b_x, 1, 1, _lastButton == MenuButtons::Save);
 	auto markerDims = _menuFrame.DrawRect(4 + saveDims.b_x, 4, 4 + saveDims.b_x + 8, 4 + 8, _regulatingOpacity ? 5 : (_useMarker ? 3 : 4));
 	auto testDims = _menuFrame.DrawRect(4 + saveDims.b_x, 1, 4 + saveDims.b_x + 8, 3, 6);
 
-	std::stringstream ss;
-	ss << "[" << _pointX << "|" << _pointY << "]";
-	_menuFrame.DrawTextRegular(_menuFont, ss.str(), 6 + markerDims.b_x, 1, 2);
+	char coords[32];
+	snprintf(coords, sizeof(coords), "[%d|%d]", _pointX, _pointY);
+	_menuFrame.DrawTextRegular(s_menuFont, coords, 6 + markerDims.b_x, 1, 2);
+
+	int progress = _progress;
+	if (progress >= 0)
+		_menuFrame.DrawRect(0, MenuHeight - 1, Max(1, _width * progress / 1000), MenuHeight, 2);
 
 	if (!firstDraw)
 	{
@@ -299,6 +422,8 @@ void Canvas::_redrawMenu()
 
 void Canvas::_draw()
 {
+	TRACE_THREAD("render");
+	ArenaBinding arenaBinding(_frameArena);
 	try
 	{
 		_pw = std::make_shared<pw::PixelWindow>(_width * _scale, (_height + MenuHeight) * _scale, _title.c_str());
@@ -306,13 +431,22 @@ void Canvas::_draw()
 		_pw->addMouseCallback(&callbackMouse);
 		_pw->setCloseCallback(&callbackClose);
 		_pw->addCursorPosCallback(callbackCursor);
-		_lastButton = MenuButtons::None;
-		_menuFrame.ReInit(_width, _height);
-		_holdDraw = false;
-		_doDraw = 0;
-		_redrawMenu();
-		_reinit.reset();
-		_copiedCell.clear();
+		{
+			std::lock_guard<std::mutex> guard(s_keyTargetsLock);
+			s_keyTargets[_pw->_getHandle()] = this;
+		}
+		glfwSetKeyCallback(_pw->_getHandle(), &callbackKey);
+		{
+			//The I/O and autosave threads look at _reinit under the lock
+			TRACE_LOCK(_lock, "Canvas::_lock");
+			_lastButton = MenuButtons::None;
+			_menuFrame.ReInit(_width, _height);
+			_stroking = false;
+			_redrawMenu();
+			_reinit.reset();
+			_workspace.ClearClipboard();
+			_anchored = false;
+		}
 
 		HICON hIcon = LoadIcon(GetModuleHandle(NULL), MAKEINTRESOURCE(IDI_ICON1));
 		SendMessage(glfwGetWin32Window(_pw->_getHandle()), WM_SETICON, ICON_SMALL, (LPARAM)hIcon);
@@ -325,142 +459,87 @@ void Canvas::_draw()
 
 		while (!_closed && _pw->isActive())
 		{
+			TRACE_SCOPE("frame");
+			AllocScope allocScope(AllocTag::Render);
+			_frameArena.Reset();
+			_stats.BeginFrame();
 			Canvas::TimePoint now = std::chrono::system_clock::now();
 			auto now_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(now);
 			auto last_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(_lastMenuClick);
 			if (now_ms - last_ms > 350ms)
 			{
+				TRACE_LOCK(_lock, "Canvas::_lock");
 				_lastButton = MenuButtons::None;
 				_redrawMenu();
 			}
 
 			_pw->makeCurrent();
 
-			_pw->pollEvents();
-			_pw->beginFrame();
-
-			_pw->setBackgroundColor(_background);
-
-			_lock.lock();
-			if (_frame[_pointY][_pointX] != 3 && _frame[_pointY][_pointX] != 5)
 			{
-				switch (_doDraw)
-				{
-				case 0:
-					//DoNothing
-					break;
-
-				case 1:
-					_frame[_pointY][_pointX] = 1;
-					if (!_holdDraw)
-						_doDraw = 0;
-					break;
-
-				case 2:
-					_frame[_pointY][_pointX] = 0;
-					if (!_holdDraw)
-						_doDraw = 0;
-					break;
-				}
+				TRACE_SCOPE("pollEvents");
+				_pw->pollEvents();
 			}
+			_pw->beginFrame();
 
-			auto copy = _frame;
-			auto menu = _menuFrame.GetBitmap();
-
-			auto calculateHelperColor = [](pixel_t px) -> pixel_t
-			{
-				return (px == 3 || px == 5) ? px : (px == 1 ? 7 : 6);
-			};
-
-			if (_enableHelper)
-			{
-				for (size_t y = 0; y < copy.size(); y++)
-					copy[y][_pointX] = calculateHelperColor(copy[y][_pointX]);
-				for (size_t x = 0; x < copy[0].size(); x++)
-					copy[_pointY][x] = calculateHelperColor(copy[_pointY][x]);
-			}
-
-			if (_useMarker)
-				copy[_pointY][_pointX] = copy[_pointY][_pointX] == 0 ? 2 : 4;
-
+			_pw->setBackgroundColor(_background);
+			_stats.Mark(FrameStats::Stage::Events);
+
+			TRACE_LOCK_ACQUIRE(_lock, "Canvas::_lock");
+			_stats.Mark(FrameStats::Stage::Lock);
+			_workspace.ApplyAll(_edits);
+			_stats.Mark(FrameStats::Stage::Edits);
+
+			_presentMenu();
+			_stats.Mark(FrameStats::Stage::Menu);
+			_workspace.Present(*_pw, { _pointX, _pointY, _enableHelper, _useMarker, _anchored, _anchorX, _anchorY, _brush }, _scale, MenuHeight);
+			if (_showStats)
+				_presentStats();
 			_lock.unlock();
-			bmpUpscaleLinear(copy, _scale);
-			bmpUpscaleLinear(menu, _scale);
+			_stats.Mark(FrameStats::Stage::Compose);
 
-			for (int y = 0; y < Min(MenuHeight * _scale, menu.size()); y++)
 			{
-				for (int x = 0; x < Min(_width * _scale, menu[y].size()); x++)
-				{
-					if (menu[y][x] == 1)
-						_pw->setPixel(x, y, 0xFFFFFFFF);
-					else if (menu[y][x] == 2)
-						_pw->setPixel(x, y, 0xFFFF00FF);
-					else if (menu[y][x] == 3)
-						_pw->setPixel(x, y, 0xFF00FF00);
-					else if (menu[y][x] == 4)
-						_pw->setPixel(x, y, 0x55555555);
-					else if (menu[y][x] == 5)
-						_pw->setPixel(x, y, 0xFFFFD6FF);
-					else if (menu[y][x] == 6)
-						_pw->setPixel(x, y, 0xFFFFAAAA);
-					else
-						_pw->setPixel(x, y, 0xFF000044);
-				}
+				TRACE_SCOPE("endFrame");
+				_pw->endFrame();
 			}
-
-			for (int y = 0; y < Min(_height * _scale, copy.size()); y++)
-			{
-				for (int x = 0; x < Min(_width * _scale, copy[y].size()); x++)
-				{
-					if (copy[y][x] == 1)
-						_pw->setPixel(x, y + MenuHeight * _scale, _brush);
-					else if (copy[y][x] == 2)
-						_pw->setPixel(x, y + MenuHeight * _scale, 0xFF00FF00);
-					else if (copy[y][x] == 3)
-						_pw->setPixel(x, y + MenuHeight * _scale, 0xFF0000BA);
-					else if (copy[y][x] == 4)
-						_pw->setPixel(x, y + MenuHeight * _scale, 0xFF008800);
-					else if (copy[y][x] == 5)
-						_pw->setPixel(x, y + MenuHeight * _scale, 0x55555555);
-					else if (copy[y][x] == 6)
-						_pw->setPixel(x, y + MenuHeight * _scale, 0xFF000055);
-					else if (copy[y][x] == 7)
-						_pw->setPixel(x, y + MenuHeight * _scale, 0xFFCC95AC);
-				}
-			}
-
-			_pw->endFrame();
+			_stats.Mark(FrameStats::Stage::Present);
+			_stats.EndFrame();
 		}
 
 		_closed = true;
 		_pw->forceClose();
-		_pw.reset();	
 	}
 	catch (const std::exception& ex)
 	{
 		MessageBoxA(NULL, ex.what(), "Exception", MB_OK | MB_ICONERROR);
 		_closed = true;
-		_pw.reset();
 	}
+
+	if (_pw)
+	{
+		std::lock_guard<std::mutex> guard(s_keyTargetsLock);
+		s_keyTargets.erase(_pw->_getHandle());
+	}
+	_pw.reset();
+	_input.Wake();
 }
 
 void Canvas::SetCanvasCallback(MouseCallback callback)
 {
-	std::lock_guard<std::mutex> guard(_lock);
+	TRACE_LOCK(_lock, "Canvas::_lock");
 	_callbackCanvas = callback;
 	_cc = true;
 }
 
 void Canvas::SetMenuCallback(MenuCallback callback)
 {
-	std::lock_guard<std::mutex> guard(_lock);
+	TRACE_LOCK(_lock, "Canvas::_lock");
 	_callbackMenu = callback;
 	_mc = true;
 }
 
 void Canvas::SetCloseCallback(CloseCallback callback)
 {
-	std::lock_guard<std::mutex> guard(_lock);
+	TRACE_LOCK(_lock, "Canvas::_lock");
 	_callbackClose = callback;
 	_clc = true;
 }
@@ -469,7 +548,7 @@ bool Canvas::IsClosed() const
 {
 	if (_closed)
 		_thread->join();
-	return _closed && !_reinit;
+	return _closed && !ReinitReady();
 }
 
 HWND Canvas::GetHWND() const
@@ -480,35 +559,48 @@ HWND Canvas::GetHWND() const
 	return glfwGetWin32Window(_pw->_getHandle());
 }
 
-void Canvas::ReInit(const bitmap_t& bmp, int w, int h, int scale)
+void Canvas::ReInit(const bitmap_t& bmp, int w, int h, int scale, int cellH, int cellW, int count)
 {
-	std::lock_guard<std::mutex> guard(_lock);
+	TRACE_LOCK(_lock, "Canvas::_lock");
 	if (!_closed)
 	{
-		_reinit = std::make_shared<reinit_t>(reinit_t({ bmp, w, h, scale, false }));
+		_reinit = std::make_shared<reinit_t>(reinit_t({ bmp, w, h, scale, cellH, cellW, count, false }));
+		_input.Wake();
 		return;
 	}
 		
 	_height = h;
 	_width = w;
 	_scale = scale;
-	Show(bmp);
+	if (bmp.empty())
+		_workspace.Reset(_width, _height);
+	else
+		_workspace.Load(bmp, cellH, cellW, count);
+	_start();
 }
 
 void Canvas::DoReinit()
 {
-	if (_reinit && !_reinit->invoked)
+	//The render thread drops _reinit once it runs, keep a reference taken under the lock
+	std::shared_ptr<reinit_t> reinit;
+	{
+		TRACE_LOCK(_lock, "Canvas::_lock");
+		reinit = _reinit;
+	}
+
+	if (reinit && !reinit->invoked)
 	{
 		if (!_closed)
 			Close();
 
-		std::lock_guard<std::mutex> guard(_lock);
+		TRACE_LOCK(_lock, "Canvas::_lock");
 		_closed = false;
-		_reinit->invoked = true;
-		_height = _reinit->h;
-		_width = _reinit->w;
-		_scale = _reinit->sc;
-		_frame = _reinit->pic;
+		reinit->invoked = true;
+		_height = reinit->h;
+		_width = reinit->w;
+		_scale = reinit->sc;
+		_workspace.Load(reinit->pic, reinit->cellH, reinit->cellW, reinit->count);
+		_edits.Clear();
 		_pointY = 0;
 		_pointX = 0;
 		_thread = std::make_shared<std::thread>(&Canvas::_draw, this);
@@ -517,7 +609,7 @@ void Canvas::DoReinit()
 
 bool Canvas::ReinitReady() const
 {
-	std::lock_guard<std::mutex> guard(_lock);
+	TRACE_LOCK(_lock, "Canvas::_lock");
 	return bool(_reinit);
 }
 
@@ -526,63 +618,105 @@ void Canvas::SetOwner(void* ptr)
 	_owner = ptr;
 }
 
-void Canvas::CopyCell(int h, int w, int count)
+void Canvas::_pushCellOp(EditOp op)
 {
-	std::lock_guard<std::mutex> guard(_lock);
-	_copiedCell.clear();
-	InitBitmap(_copiedCell, h, w);
-	int cc = 0;
-	for (size_t y = 0; y < _frame.size(); y += h + 1)
-	{
-		for (size_t x = 0; x < _frame[0].size(); x += w + 1)
-		{
-			if (cc >= count)
-				break;
+	TRACE_LOCK(_lock, "Canvas::_lock");
+	int ax = _anchored ? _anchorX : _pointX;
+	int ay = _anchored ? _anchorY : _pointY;
+	_pushEdit({ op, _pointX, _pointY, ax, ay });
+}
 
-			if (_pointY >= y && _pointY < (y + h) && _pointX >= x && _pointX < (x + w))
-			{
-				for (size_t yy = 0; yy < h; yy++)
-				{
-					for (size_t xx = 0; xx < w; xx++)
-						_copiedCell[yy][xx] = _frame[y + yy][x + xx];
-				}
-			}
+void Canvas::SetAnchor()
+{
+	TRACE_LOCK(_lock, "Canvas::_lock");
+	_anchored = !_anchored;
+	_anchorX = _pointX;
+	_anchorY = _pointY;
+}
 
-			cc++;
-		}
-	}
+void Canvas::CopyCells()
+{
+	_pushCellOp(EditOp::CopyCells);
 }
 
-void Canvas::PasteCell(int h, int w, int count)
+void Canvas::PasteCells()
 {
-	std::lock_guard<std::mutex> guard(_lock);
+	_pushCellOp(EditOp::PasteCells);
+}
 
-	if (_copiedCell.empty())
-		return;
+void Canvas::SwapCells()
+{
+	_pushCellOp(EditOp::SwapCells);
+}
 
-	int cc = 0;
-	for (size_t y = 0; y < _frame.size(); y += h + 1)
-	{
-		for (size_t x = 0; x < _frame[0].size(); x += w + 1)
-		{
-			if (cc >= count)
-				break;
+void Canvas::FillCells(bool erase)
+{
+	_pushCellOp(erase ? EditOp::ClearCells : EditOp::FillCells);
+}
 
-			if (_pointY >= y && _pointY < (y + h) && _pointX >= x && _pointX < (x + w))
-			{
-				for (size_t yy = 0; yy < h; yy++)
-				{
-					for (size_t xx = 0; xx < w; xx++)
-						_frame[y + yy][x + xx] = _copiedCell[yy][xx];
-				}
-			}
+void Canvas::Undo()
+{
+	_endStroke();
+	_pushEdit({ EditOp::Undo });
+}
 
-			cc++;
-		}
-	}
+void Canvas::Redo()
+{
+	_endStroke();
+	_pushEdit({ EditOp::Redo });
 }
 
 void Canvas::SwitchHelper()
 {
 	_enableHelper = !_enableHelper;
+}
+
+void Canvas::SwitchStats()
+{
+	_showStats = !_showStats;
+}
+
+const FrameStats& Canvas::GetFrameStats() const
+{
+	return _stats;
+}
+
+void Canvas::_presentStats()
+{
+	//Text is rebuilt a few times per second, in between the frame only copies pixels
+	TimePoint now = std::chrono::system_clock::now();
+	if (now - _lastStatsUpdate > 250ms)
+	{
+		//Tracked allocations per frame since the previous refresh
+		AllocCounters render = AllocStats::Get(AllocTag::Render), workspace = AllocStats::Get(AllocTag::Workspace);
+		AllocCounters allocs = { render.allocs + workspace.allocs, 0, render.bytes + workspace.bytes, 0 };
+		size_t frames = _stats.GetFrame().frames;
+		size_t elapsed = frames > _lastStatsFrames ? frames - _lastStatsFrames : 1;
+
+		char line[96];
+		snprintf(line, sizeof(line), "\nalloc   %llu/%lluB\narena   %llu/%lluB", (unsigned long long)((allocs.allocs - _lastAllocs.allocs) / elapsed),
+			(unsigned long long)((allocs.bytes - _lastAllocs.bytes) / elapsed),
+			(unsigned long long)_frameArena.GetPeak(), (unsigned long long)_frameArena.GetCapacity());
+		_lastAllocs = allocs;
+		_lastStatsFrames = frames;
+
+		std::string text = _stats.Format() + line;
+		auto dims = VirtualCanvas::MeasureText(s_menuFont, text, true);
+		_statsFrame.ReInit(Min(dims.b_x + 2, _width), Min(dims.b_y + 2, _height));
+		_statsFrame.DrawTextRegular(s_menuFont, text, 1, 1, 1, false, true);
+		_lastStatsUpdate = now;
+	}
+
+	_statsFrame.Present(*_pw, [](pixel_t px) { return px ? 0xFFFFFFFFu : 0xFF202020u; }, _scale, _width, _height, MenuHeight);
+}
+
+void Canvas::WaitInput(InputEvent& ev)
+{
+	_input.Wait(ev);
+}
+
+//Shown as a bar along the bottom of the menu, any thread may call it
+void Canvas::SetProgress(double progress)
+{
+	_progress = progress < 0.0 ? -1 : int(Min(progress, 1.0) * 1000);
 }
\ No newline at end of file
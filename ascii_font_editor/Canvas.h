@@ -11,6 +11,12 @@
 #include "VirtualCanvas.h"
 #include "Font.h"
 #include "Utils.h"
+#include "WinUtils.h"
+#include "EditQueue.h"
+#include "Workspace.h"
+#include "FrameStats.h"
+#include "FrameArena.h"
+#include "InputQueue.h"
 
 class Canvas
 {
@@ -37,6 +43,9 @@ protected:
 		int w;
 		int h;
 		int sc;
+		int cellH;
+		int cellW;
+		int count;
 		bool invoked;
 	};
 
@@ -44,7 +53,7 @@ protected:
 	std::shared_ptr<std::thread>		_thread;
 	std::string							_title;
 	mutable std::mutex					_lock;
-	bitmap_t							_frame;
+	Workspace							_workspace;
 	int									_width;
 	int									_height;
 	uint32_t							_background;
@@ -53,7 +62,12 @@ protected:
 	int									_pointX;
 	int									_pointY;
 	int									_scale;
-	std::atomic<uint8_t>				_doDraw;
+	SpscQueue<EditCommand>				_edits;
+	std::mutex							_editLock;
+	std::atomic<bool>					_stroking;
+	std::atomic<bool>					_strokeErase;
+	int									_strokeX;	//Stroke origin, guarded by _editLock
+	int									_strokeY;
 	std::atomic<bool>					_cc;
 	std::atomic<bool>					_mc;
 	std::atomic<bool>					_clc;
@@ -61,55 +75,83 @@ protected:
 	MouseCallback						_callbackCanvas;
 	MenuCallback						_callbackMenu;
 	CloseCallback						_callbackClose;
-	Font								_menuFont;
 	VirtualCanvas						_menuFrame;
 	std::vector<VirtualCanvas::Dims>	_menuButtons;
 	MenuButtons							_lastButton;
 	TimePoint							_lastMenuClick;
 	std::shared_ptr<reinit_t>			_reinit;
 	void*								_owner;
-	std::atomic<bool>					_holdDraw;
-	TimePoint							_lastDrawCall;
 	std::atomic<bool>					_regulatingOpacity;
 	float								_initialROPos;
 	float								_opacity;
-	bitmap_t							_copiedCell;
+	bool								_anchored;
+	int									_anchorX;
+	int									_anchorY;
 	std::atomic<bool>					_enableHelper;
+	FrameStats							_stats;
+	VirtualCanvas						_statsFrame;
+	std::atomic<bool>					_showStats;
+	TimePoint							_lastStatsUpdate;
+	AllocCounters						_lastAllocs;	//Render and workspace counters at the last overlay refresh
+	size_t								_lastStatsFrames;
+	FrameArena							_frameArena;	//Transient buffers of the render thread
+	InputQueue							_input;
+	std::atomic<int>					_progress;		//Background file operation in permille, -1 when idle
 
 	Canvas(Canvas&) = delete;
 	Canvas& operator=(Canvas&) = delete;
 
 	void _draw();
+	void _start();
 	void _redrawMenu();
+	void _pushEdit(const EditCommand& cmd);
+	void _strokeTo(int x, int y);
+	void _endStroke();
+	void _presentMenu();
+	void _presentStats();
+	void _pushCellOp(EditOp op);
 
 	friend void callbackMouse(void* owner, pw::mpos pos, int button, int action, int modes);
 	friend bool callbackClose(void* owner);
 	friend void callbackCursor(void* owner, pw::mpos pos);
+	friend void callbackKey(GLFWwindow* window, int key, int scancode, int action, int mods);
 
 public:
 	Canvas(int w, int h, int scale = 1, const std::string& title = "Preview", bool startHidden = false, uint32_t brush = 0xFFFFFF00, uint32_t background = 0x00000000);
 	~Canvas();
 
 	bitmap_t GetPicture() const;
+	uint32_t ReadPicture(const std::function<void(const bitmap_t&, const CellGeometry&)>& reader) const;
+	uint32_t TakeDirtyCells(std::vector<int>& cells, std::vector<uint8_t>& bits);
 	bool IsClosed() const;
 	HWND GetHWND() const;
 	bool ReinitReady() const;
 	template<class T>
 	T* GetOwner() const { return reinterpret_cast<T*>(_owner); }
 
-	void SetPicture(const bitmap_t& picture);
+	void SetPicture(const bitmap_t& picture, int cellH, int cellW, int count);
 	void Show(const bitmap_t& bmp = {});
 	void Close();
 	void MovePoint(int x, int y);
+	void MoveCell(int x, int y);
 	bool SetPoint(int x, int y);
 	void Draw(bool erase, bool hold = false);
 	void SetCanvasCallback(MouseCallback callback);
 	void SetMenuCallback(MenuCallback callback);
 	void SetCloseCallback(CloseCallback callback);
-	void ReInit(const bitmap_t& bmp, int w, int h, int scale);
+	void ReInit(const bitmap_t& bmp, int w, int h, int scale, int cellH, int cellW, int count);
 	void DoReinit();
 	void SetOwner(void* ptr);
-	void CopyCell(int h, int w, int count);
-	void PasteCell(int h, int w, int count);
+	void SetAnchor();
+	void CopyCells();
+	void PasteCells();
+	void SwapCells();
+	void FillCells(bool erase);
+	void Undo();
+	void Redo();
 	void SwitchHelper();
+	void SwitchStats();
+	const FrameStats& GetFrameStats() const;
+	void WaitInput(InputEvent& ev);
+	void SetProgress(double progress);
 };
\ No newline at end of file
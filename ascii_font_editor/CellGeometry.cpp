@@ -0,0 +1,80 @@
+#include "CellGeometry.h"
+
+CellGeometry::CellGeometry()
+	: _cellW(0)
+	, _cellH(0)
+	, _count(0)
+	, _columns(0)
+{
+}
+
+CellGeometry::CellGeometry(int cellH, int cellW, int count, int tableWidth)
+	: _cellW(cellW)
+	, _cellH(cellH)
+	, _count(count)
+	, _columns(0)
+{
+	if (_cellW > 0 && _cellH > 0)
+		_columns = (tableWidth + 1) / (_cellW + 1);
+	if (_columns <= 0)
+		_count = 0;
+}
+
+bool CellGeometry::IsEmpty() const
+{
+	return _columns <= 0;
+}
+
+int CellGeometry::CellWidth() const
+{
+	return _cellW;
+}
+
+int CellGeometry::CellHeight() const
+{
+	return _cellH;
+}
+
+int CellGeometry::Count() const
+{
+	return _count;
+}
+
+int CellGeometry::Columns() const
+{
+	return _columns;
+}
+
+bool CellGeometry::IsGridLine(int x, int y) const
+{
+	if (IsEmpty())
+		return false;
+
+	return x % (_cellW + 1) == _cellW || y % (_cellH + 1) == _cellH;
+}
+
+//Returns false for grid lines, empty cells after the last char and pixels outside the table
+bool CellGeometry::Locate(int x, int y, Cell& cell) const
+{
+	if (IsEmpty() || x < 0 || y < 0)
+		return false;
+
+	int col = x / (_cellW + 1), row = y / (_cellH + 1);
+	if (col >= _columns)
+		return false;
+
+	cell.index = row * _columns + col;
+	cell.x = x - col * (_cellW + 1);
+	cell.y = y - row * (_cellH + 1);
+	return cell.index < _count && cell.x < _cellW && cell.y < _cellH;
+}
+
+int CellGeometry::OriginX(int index) const
+{
+	return (index % _columns) * (_cellW + 1);
+}
+
+int CellGeometry::OriginY(int index) const
+{
+	return (index / _columns) * (_cellH + 1);
+}
\ No newline at end of file
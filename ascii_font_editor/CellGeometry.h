@@ -0,0 +1,36 @@
+#pragma once
+
+//Layout of a font table produced by Font::getFontTable:
+//cells of CellWidth x CellHeight separated by 1px grid lines, Columns cells per row.
+//Maps table pixels to cells and back with plain arithmetic.
+class CellGeometry
+{
+public:
+	struct Cell
+	{
+		int index;
+		int x;	//Pixel inside the cell
+		int y;
+	};
+
+private:
+	int		_cellW;
+	int		_cellH;
+	int		_count;
+	int		_columns;
+
+public:
+	CellGeometry();
+	CellGeometry(int cellH, int cellW, int count, int tableWidth);
+
+	bool IsEmpty() const;
+	int CellWidth() const;
+	int CellHeight() const;
+	int Count() const;
+	int Columns() const;
+
+	bool IsGridLine(int x, int y) const;
+	bool Locate(int x, int y, Cell& cell) const;
+	int OriginX(int index) const;
+	int OriginY(int index) const;
+};
\ No newline at end of file
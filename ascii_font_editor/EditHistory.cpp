@@ -0,0 +1,206 @@
+#include "EditHistory.h"
+#include <algorithm>
+
+EditHistory::EditHistory(size_t limitBytes)
+	: _cellW(0)
+	, _cellH(0)
+	, _pitchX(1)
+	, _pitchY(1)
+	, _columns(1)
+	, _maskSize(0)
+	, _limit(limitBytes)
+	, _bytes(0)
+	, _open(false)
+{
+}
+
+void EditHistory::Reset(const CellGeometry& geom)
+{
+	_reset(geom.CellWidth(), geom.CellHeight(), geom.CellWidth() + 1, geom.CellHeight() + 1, Max(geom.Columns(), 1), geom.Count());
+}
+
+void EditHistory::Reset(int width, int height, int tile)
+{
+	int columns = (width + tile - 1) / tile, rows = (height + tile - 1) / tile;
+	_reset(tile, tile, tile, tile, Max(columns, 1), columns * rows);
+}
+
+void EditHistory::_reset(int cellW, int cellH, int pitchX, int pitchY, int columns, int count)
+{
+	_cellW = cellW;
+	_cellH = cellH;
+	_pitchX = pitchX;
+	_pitchY = pitchY;
+	_columns = columns;
+	_maskSize = (size_t(cellW) * cellH + 7) / 8;
+	_undo.clear();
+	_redo.clear();
+	_bytes = 0;
+	_open = false;
+	_touched.clear();
+	_before.clear();
+	_slot.assign(count, -1);
+}
+
+//Pixels past the frame edge stay zero, so _toggle never reaches them
+void EditHistory::_pack(const bitmap_t& frame, int cell, uint8_t* out) const
+{
+	int ox = (cell % _columns) * _pitchX, oy = (cell / _columns) * _pitchY;
+	int h = Min(_cellH, (int)frame.size() - oy);
+	std::fill(out, out + _maskSize, 0);
+
+	for (int y = 0; y < h; y++)
+	{
+		const pixel_row_t& row = frame[oy + y];
+		int w = Min(_cellW, (int)row.size() - ox);
+		size_t bit = size_t(y) * _cellW;
+		for (int x = 0; x < w; x++, bit++)
+		{
+			if (row[ox + x])
+				out[bit >> 3] |= uint8_t(1 << (bit & 7));
+		}
+	}
+}
+
+void EditHistory::_toggle(bitmap_t& frame, const Entry& entry) const
+{
+	int w = _cellW;
+	for (size_t i = 0; i < entry.cells.size(); i++)
+	{
+		int ox = (entry.cells[i] % _columns) * _pitchX, oy = (entry.cells[i] / _columns) * _pitchY;
+		const uint8_t* mask = &entry.masks[i * _maskSize];
+		for (size_t b = 0; b < _maskSize; b++)
+		{
+			if (!mask[b])
+				continue;
+
+			for (int k = 0; k < 8; k++)
+			{
+				if (mask[b] & (1 << k))
+				{
+					size_t bit = b * 8 + k;
+					pixel_t& px = frame[oy + bit / w][ox + bit % w];
+					px = px ? 0 : 1;
+				}
+			}
+		}
+	}
+}
+
+//Redo entries farthest from the current state go first, then the oldest undo entries.
+//The newest undo entry always stays.
+void EditHistory::_trim()
+{
+	while (_bytes > _limit && !_redo.empty())
+	{
+		_bytes -= _entrySize(_redo.front());
+		_redo.pop_front();
+	}
+
+	while (_bytes > _limit && _undo.size() > 1)
+	{
+		_bytes -= _entrySize(_undo.front());
+		_undo.pop_front();
+	}
+}
+
+size_t EditHistory::_entrySize(const Entry& entry)
+{
+	return entry.cells.capacity() * sizeof(int) + entry.masks.capacity() + sizeof(Entry);
+}
+
+void EditHistory::Begin()
+{
+	_open = true;
+}
+
+//Must be called before the first change of a cell inside an open entry
+void EditHistory::Touch(const bitmap_t& frame, int cell)
+{
+	if (!_open || cell < 0 || cell >= (int)_slot.size() || _slot[cell] >= 0)
+		return;
+
+	_slot[cell] = (int)_touched.size();
+	_touched.push_back(cell);
+	_before.resize(_touched.size() * _maskSize);
+	_pack(frame, cell, &_before[_before.size() - _maskSize]);
+}
+
+void EditHistory::Commit(const bitmap_t& frame)
+{
+	if (!_open)
+		return;
+	_open = false;
+
+	Entry entry;
+	std::vector<uint8_t> after(_maskSize);
+	for (size_t i = 0; i < _touched.size(); i++)
+	{
+		int cell = _touched[i];
+		_slot[cell] = -1;
+		_pack(frame, cell, after.data());
+
+		const uint8_t* before = &_before[i * _maskSize];
+		bool changed = false;
+		for (size_t b = 0; b < _maskSize; b++)
+		{
+			after[b] ^= before[b];
+			changed = changed || after[b] != 0;
+		}
+
+		if (changed)
+		{
+			entry.cells.push_back(cell);
+			entry.masks.insert(entry.masks.end(), after.begin(), after.end());
+		}
+	}
+	_touched.clear();
+	_before.clear();
+
+	if (entry.cells.empty())
+		return;
+
+	for (auto& e : _redo)
+		_bytes -= _entrySize(e);
+	_redo.clear();
+	_bytes += _entrySize(entry);
+	_undo.push_back(std::move(entry));
+	_trim();
+}
+
+bool EditHistory::Undo(bitmap_t& frame, std::vector<int>* changed)
+{
+	if (_undo.empty())
+		return false;
+
+	_toggle(frame, _undo.back());
+	if (changed)
+		changed->insert(changed->end(), _undo.back().cells.begin(), _undo.back().cells.end());
+	_redo.push_back(std::move(_undo.back()));
+	_undo.pop_back();
+	_trim();
+	return true;
+}
+
+bool EditHistory::Redo(bitmap_t& frame, std::vector<int>* changed)
+{
+	if (_redo.empty())
+		return false;
+
+	_toggle(frame, _redo.back());
+	if (changed)
+		changed->insert(changed->end(), _redo.back().cells.begin(), _redo.back().cells.end());
+	_undo.push_back(std::move(_redo.back()));
+	_redo.pop_back();
+	return true;
+}
+
+bool EditHistory::IsOpen() const
+{
+	return _open;
+}
+
+size_t EditHistory::MemoryUsage() const
+{
+	return _bytes;
+}
\ No newline at end of file
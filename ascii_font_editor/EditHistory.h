@@ -0,0 +1,56 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <cstdint>
+#include "Utils.h"
+#include "CellGeometry.h"
+
+//Undo/redo history of glyph edits.
+//An entry keeps XOR bit masks of the cells it changed, so undo and redo are the same
+//operation and cost is proportional to the touched cells, not to the workspace size.
+//A blank canvas has no cells, it is split into square tiles instead.
+class EditHistory
+{
+private:
+	struct Entry
+	{
+		std::vector<int>		cells;
+		std::vector<uint8_t>	masks;	//One packed XOR mask per cell, in cells order
+	};
+
+	int						_cellW;
+	int						_cellH;
+	int						_pitchX;	//Cell pitch, tiles of a blank canvas have no grid line between them
+	int						_pitchY;
+	int						_columns;
+	size_t					_maskSize;
+	size_t					_limit;
+	size_t					_bytes;		//Undo and redo entries together
+	std::deque<Entry>		_undo;
+	std::deque<Entry>		_redo;
+	bool					_open;
+	std::vector<int>		_touched;
+	std::vector<uint8_t>	_before;	//Cell bits at the moment a cell was first touched
+	std::vector<int>		_slot;		//Cell index -> position in _touched, -1 if untouched
+
+	void _reset(int cellW, int cellH, int pitchX, int pitchY, int columns, int count);
+	void _pack(const bitmap_t& frame, int cell, uint8_t* out) const;
+	void _toggle(bitmap_t& frame, const Entry& entry) const;
+	void _trim();
+	static size_t _entrySize(const Entry& entry);
+
+public:
+	EditHistory(size_t limitBytes = 64 * 1024 * 1024);
+
+	void Reset(const CellGeometry& geom);
+	//Tiles of tile x tile pixels row by row, the ones on the right and bottom edges are clipped
+	void Reset(int width, int height, int tile);
+	void Begin();
+	void Touch(const bitmap_t& frame, int cell);
+	void Commit(const bitmap_t& frame);
+	bool Undo(bitmap_t& frame, std::vector<int>* changed = nullptr);	//Appends the toggled cells to changed
+	bool Redo(bitmap_t& frame, std::vector<int>* changed = nullptr);
+
+	bool IsOpen() const;
+	size_t MemoryUsage() const;
+};
\ No newline at end of file
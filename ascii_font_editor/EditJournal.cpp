@@ -0,0 +1,177 @@
+#include "EditJournal.h"
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+
+static const char s_journalMagic[4] = { 'F', 'N', 'T', 'J' };
+static const uint32_t s_journalVersion = 1;
+static const size_t s_journalHeader = 4 + 6 * 4;
+
+//FNV-1a, catches torn and garbled writes
+static uint32_t checksum(const uint8_t* data, size_t size)
+{
+	uint32_t h = 2166136261u;
+	for (size_t i = 0; i < size; i++)
+	{
+		h ^= data[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static void putLE32(uint8_t* p, uint32_t v)
+{
+	p[0] = v & 0xFF;
+	p[1] = (v >> 8) & 0xFF;
+	p[2] = (v >> 16) & 0xFF;
+	p[3] = (v >> 24) & 0xFF;
+}
+
+static uint32_t getLE32(const uint8_t* p)
+{
+	return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+EditJournal::EditJournal()
+	: _header({ 0, 0, 0, 0 })
+	, _cellBytes(0)
+{
+}
+
+void EditJournal::Create(const std::string& path, const Header& header)
+{
+	if (header.width <= 0 || header.height <= 0 || header.count <= 0)
+		throw std::runtime_error("Invalid journal cell layout");
+
+	Close();
+	_header = header;
+	_cellBytes = CellBytes(header.width, header.height);
+	_record.resize(4 + _cellBytes + 4);
+	_out.reset(new FileWriter(path, 16 * 1024));
+
+	uint8_t head[s_journalHeader];
+	memcpy(head, s_journalMagic, 4);
+	putLE32(head + 4, s_journalVersion);
+	putLE32(head + 8, header.sequence);
+	putLE32(head + 12, (uint32_t)header.width);
+	putLE32(head + 16, (uint32_t)header.height);
+	putLE32(head + 20, (uint32_t)header.count);
+	putLE32(head + 24, checksum(head, 24));
+	_out->Write(head, sizeof(head));
+	_out->Flush();
+}
+
+void EditJournal::Append(int cell, const uint8_t* bits)
+{
+	if (!_out)
+		throw std::runtime_error("Journal is not open");
+
+	putLE32(&_record[0], (uint32_t)cell);
+	memcpy(&_record[4], bits, _cellBytes);
+	putLE32(&_record[4 + _cellBytes], checksum(_record.data(), 4 + _cellBytes));
+	_out->Write(_record.data(), _record.size());
+}
+
+void EditJournal::Flush()
+{
+	if (_out)
+		_out->Flush();
+}
+
+void EditJournal::Close()
+{
+	if (!_out)
+		return;
+
+	std::unique_ptr<FileWriter> out = std::move(_out);
+	out->Close();
+}
+
+bool EditJournal::IsOpen() const
+{
+	return bool(_out);
+}
+
+uint64_t EditJournal::GetSize() const
+{
+	return _out ? _out->GetWritten() : 0;
+}
+
+const EditJournal::Header& EditJournal::GetHeader() const
+{
+	return _header;
+}
+
+size_t EditJournal::CellBytes(int w, int h)
+{
+	return (size_t(w) * h + 7) / 8;
+}
+
+void EditJournal::PackCell(const bitmap_t& frame, const CellGeometry& geom, int cell, uint8_t* out)
+{
+	int w = geom.CellWidth(), h = geom.CellHeight();
+	int ox = geom.OriginX(cell), oy = geom.OriginY(cell);
+	memset(out, 0, CellBytes(w, h));
+
+	size_t bit = 0;
+	for (int y = 0; y < h; y++)
+	{
+		const pixel_t* row = &frame[oy + y][ox];
+		for (int x = 0; x < w; x++, bit++)
+		{
+			if (row[x])
+				out[bit >> 3] |= uint8_t(1 << (bit & 7));
+		}
+	}
+}
+
+static bool readHeader(std::ifstream& file, EditJournal::Header& header)
+{
+	uint8_t head[s_journalHeader];
+	if (!file.read((char*)head, sizeof(head)))
+		return false;
+
+	if (memcmp(head, s_journalMagic, 4) != 0 || getLE32(head + 4) != s_journalVersion || getLE32(head + 24) != checksum(head, 24))
+		return false;
+
+	header.sequence = getLE32(head + 8);
+	header.width = (int)getLE32(head + 12);
+	header.height = (int)getLE32(head + 16);
+	header.count = (int)getLE32(head + 20);
+	return header.width > 0 && header.height > 0 && header.count > 0 && header.width <= 0xFFFF && header.height <= 0xFFFF;
+}
+
+bool EditJournal::ReadHeader(const std::string& path, Header& header)
+{
+	std::ifstream file(path, std::ios::binary);
+	return file && readHeader(file, header);
+}
+
+size_t EditJournal::Replay(const std::string& path, std::vector<unsigned char>& glyphBits)
+{
+	std::ifstream file(path, std::ios::binary);
+	Header header;
+	if (!file || !readHeader(file, header))
+		throw std::runtime_error("Journal header is damaged");
+
+	size_t cellPixels = size_t(header.width) * header.height;
+	if (glyphBits.size() != cellPixels * header.count)
+		throw std::runtime_error("Journal does not match the checkpoint font");
+
+	size_t cellBytes = CellBytes(header.width, header.height);
+	std::vector<uint8_t> record(4 + cellBytes + 4);
+	size_t applied = 0;
+	while (file.read((char*)record.data(), record.size()))
+	{
+		uint32_t cell = getLE32(&record[0]);
+		if (getLE32(&record[4 + cellBytes]) != checksum(record.data(), 4 + cellBytes) || cell >= (uint32_t)header.count)
+			break;
+
+		unsigned char* dst = &glyphBits[cell * cellPixels];
+		const uint8_t* bits = &record[4];
+		for (size_t i = 0; i < cellPixels; i++)
+			dst[i] = (bits[i >> 3] >> (i & 7)) & 1;
+		applied++;
+	}
+	return applied;
+}
\ No newline at end of file
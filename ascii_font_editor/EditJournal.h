@@ -0,0 +1,54 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "Utils.h"
+#include "CellGeometry.h"
+#include "FileWriter.h"
+
+//Append-only log of glyph cell states, little endian:
+//"FNTJ", uint32 version, sequence, cell width, height, cell count, header checksum,
+//then records of uint32 cell index, the cell bits and a checksum of both.
+//Cell bits go row by row, bit i of a cell is bit i % 8 of byte i / 8.
+//A record holds the whole cell after the change, so replaying a record twice is harmless and a torn
+//record at the end of the file is simply skipped. Records of an older journal would roll a newer
+//checkpoint back, Autosave removes a slot's journal before it writes a new checkpoint there.
+class EditJournal
+{
+public:
+	struct Header
+	{
+		uint32_t	sequence;	//Picks the newest of several journals
+		int			width;
+		int			height;
+		int			count;
+	};
+
+private:
+	std::unique_ptr<FileWriter>	_out;
+	Header						_header;
+	size_t						_cellBytes;
+	std::vector<uint8_t>		_record;
+
+	EditJournal(EditJournal&) = delete;
+	EditJournal& operator=(EditJournal&) = delete;
+
+public:
+	EditJournal();
+
+	void Create(const std::string& path, const Header& header);
+	void Append(int cell, const uint8_t* bits);
+	void Flush();
+	void Close();
+
+	bool IsOpen() const;
+	uint64_t GetSize() const;
+	const Header& GetHeader() const;
+
+	static size_t CellBytes(int w, int h);
+	static void PackCell(const bitmap_t& frame, const CellGeometry& geom, int cell, uint8_t* out);
+	static bool ReadHeader(const std::string& path, Header& header);
+	//Applies the intact records to glyph bits laid out like Font::GetBits, returns how many were applied
+	static size_t Replay(const std::string& path, std::vector<unsigned char>& glyphBits);
+};
\ No newline at end of file
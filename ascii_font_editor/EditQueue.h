@@ -0,0 +1,130 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+enum class EditOp
+{
+	SetPixel,
+	Erase,
+	Line,
+	CopyCells,
+	PasteCells,
+	SwapCells,
+	FillCells,
+	ClearCells,
+	BeginStroke,
+	EndStroke,
+	Undo,
+	Redo
+};
+
+struct EditCommand
+{
+	EditOp	op;
+	int		x0;
+	int		y0;
+	int		x1;		//Line end point or range anchor for cell ops, equals x0/y0 for single pixel ops
+	int		y1;
+	bool	erase;	//Line brush
+};
+
+//Unbounded single producer / single consumer queue.
+//Items are stored in fixed blocks, the producer never blocks and never drops an item.
+//Drained blocks are handed back to the producer, so steady state pushes do not allocate.
+template<class T, size_t BlockSize = 256>
+class SpscQueue
+{
+private:
+	struct Block
+	{
+		T						items[BlockSize];
+		std::atomic<size_t>		written;
+		std::atomic<Block*>		next;
+
+		Block() : written(0), next(nullptr) {}
+	};
+
+	Block*					_head;	//Consumer side
+	size_t					_read;
+	Block*					_tail;	//Producer side
+	std::atomic<Block*>		_spare;
+
+	SpscQueue(SpscQueue&) = delete;
+	SpscQueue& operator=(SpscQueue&) = delete;
+
+public:
+	SpscQueue()
+		: _head(new Block())
+		, _read(0)
+		, _tail(_head)
+		, _spare(nullptr)
+	{
+	}
+
+	~SpscQueue()
+	{
+		while (_head)
+		{
+			Block* next = _head->next.load();
+			delete _head;
+			_head = next;
+		}
+		delete _spare.load();
+	}
+
+	//Producer thread only
+	void Push(const T& item)
+	{
+		size_t pos = _tail->written.load(std::memory_order_relaxed);
+		if (pos == BlockSize)
+		{
+			Block* block = _spare.exchange(nullptr, std::memory_order_acquire);
+			if (block)
+			{
+				block->written.store(0, std::memory_order_relaxed);
+				block->next.store(nullptr, std::memory_order_relaxed);
+			}
+			else
+				block = new Block();
+
+			_tail->next.store(block, std::memory_order_release);
+			_tail = block;
+			pos = 0;
+		}
+
+		_tail->items[pos] = item;
+		_tail->written.store(pos + 1, std::memory_order_release);
+	}
+
+	//Consumer thread only
+	bool Pop(T& item)
+	{
+		for (;;)
+		{
+			if (_read < _head->written.load(std::memory_order_acquire))
+			{
+				item = _head->items[_read++];
+				return true;
+			}
+
+			if (_read < BlockSize)
+				return false;
+
+			Block* next = _head->next.load(std::memory_order_acquire);
+			if (!next)
+				return false;
+
+			Block* drained = _head;
+			_head = next;
+			_read = 0;
+			delete _spare.exchange(drained, std::memory_order_acq_rel);
+		}
+	}
+
+	//Consumer thread only
+	void Clear()
+	{
+		T item;
+		while (Pop(item));
+	}
+};
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+//Bit-packed font for embedding in firmware, the glyph data is written by fonted_export.
+//Glyph bits go row by row, MSB first, each glyph padded to a whole byte (the .fntb layout).
+//Ranges map runs of code points to runs of glyphs and are sorted by code point.
+//Fonts are constexpr data, drawing needs no heap and nothing is built at runtime.
+//Self contained, C++14, no standard library beyond <stdint.h> and <stddef.h>.
+struct EmbeddedGlyphRange
+{
+	uint32_t	first;	//First code point of the run
+	uint32_t	count;
+	uint32_t	glyph;	//Glyph of the first code point
+};
+
+struct EmbeddedFont
+{
+	int							width;
+	int							height;
+	int							interval;
+	bool						utf8;	//Text is UTF-8, otherwise every byte is a code point
+	const EmbeddedGlyphRange*	ranges;
+	size_t						rangeCount;
+	const uint8_t*				bits;
+	size_t						glyphCount;
+
+	constexpr size_t GlyphBytes() const
+	{
+		return (size_t(width) * height + 7) / 8;
+	}
+
+	//-1 when the font has no glyph for the code point
+	constexpr long FindGlyph(uint32_t cp) const
+	{
+		size_t lo = 0, hi = rangeCount;
+		while (lo < hi)
+		{
+			size_t mid = (lo + hi) / 2;
+			if (cp < ranges[mid].first)
+				hi = mid;
+			else if (cp - ranges[mid].first >= ranges[mid].count)
+				lo = mid + 1;
+			else
+				return long(ranges[mid].glyph + (cp - ranges[mid].first));
+		}
+		return -1;
+	}
+
+	constexpr bool Pixel(size_t glyph, int x, int y) const
+	{
+		size_t bit = size_t(y) * width + x;
+		return (bits[glyph * GlyphBytes() + bit / 8] >> (7 - bit % 8)) & 1;
+	}
+
+	//Empty columns on both sides of a glyph, blank glyphs keep their full width
+	constexpr void Trim(size_t glyph, int& left, int& right) const
+	{
+		left = 0;
+		right = width;
+		while (left < width && ColumnEmpty(glyph, left))
+			left++;
+		if (left == width)
+		{
+			left = 0;
+			return;
+		}
+		while (right > left && ColumnEmpty(glyph, right - 1))
+			right--;
+	}
+
+	constexpr bool ColumnEmpty(size_t glyph, int x) const
+	{
+		for (int y = 0; y < height; y++)
+		{
+			if (Pixel(glyph, x, y))
+				return false;
+		}
+		return true;
+	}
+
+	//Next code point of a string, advances text, 0 at the end
+	constexpr uint32_t NextCodePoint(const char*& text) const
+	{
+		uint32_t c = uint8_t(text[0]);
+		if (c == 0)
+			return 0;
+
+		int len = 1;
+		if (utf8)
+		{
+			if ((c & 0xE0) == 0xC0) { len = 2; c &= 0x1F; }
+			else if ((c & 0xF0) == 0xE0) { len = 3; c &= 0x0F; }
+			else if ((c & 0xF8) == 0xF0) { len = 4; c &= 0x07; }
+
+			for (int i = 1; i < len; i++)
+			{
+				if ((uint8_t(text[i]) & 0xC0) != 0x80)
+				{
+					//Broken sequence, the lead byte stands for itself
+					len = 1;
+					c = uint8_t(text[0]);
+					break;
+				}
+				c = (c << 6) | (uint8_t(text[i]) & 0x3F);
+			}
+		}
+
+		text += len;
+		return c;
+	}
+
+	//Calls plot(x, y) for every ink pixel, returns the advance
+	template<class Plot>
+	int DrawGlyph(size_t glyph, int x, int y, Plot&& plot, bool proportional = false) const
+	{
+		int left = 0, right = width;
+		if (proportional)
+			Trim(glyph, left, right);
+
+		for (int gy = 0; gy < height; gy++)
+		{
+			for (int gx = left; gx < right; gx++)
+			{
+				if (Pixel(glyph, gx, gy))
+					plot(x + gx - left, y + gy);
+			}
+		}
+		return right - left + interval;
+	}
+
+	//Unknown code points are skipped, '\n' starts a new line. Returns the x after the last glyph.
+	template<class Plot>
+	int DrawText(const char* text, int x, int y, Plot&& plot, bool proportional = false) const
+	{
+		int startX = x;
+		while (uint32_t cp = NextCodePoint(text))
+		{
+			if (cp == '\n')
+			{
+				x = startX;
+				y += height + 1;
+				continue;
+			}
+
+			long glyph = FindGlyph(cp);
+			if (glyph >= 0)
+				x += DrawGlyph(size_t(glyph), x, y, plot, proportional);
+		}
+		return x;
+	}
+
+	//Width of the longest line
+	constexpr int MeasureText(const char* text, bool proportional = false) const
+	{
+		int x = 0, widest = 0;
+		while (uint32_t cp = NextCodePoint(text))
+		{
+			if (cp == '\n')
+			{
+				widest = x > widest ? x : widest;
+				x = 0;
+				continue;
+			}
+
+			long glyph = FindGlyph(cp);
+			if (glyph < 0)
+				continue;
+
+			int left = 0, right = width;
+			if (proportional)
+				Trim(size_t(glyph), left, right);
+			x += right - left + interval;
+		}
+		return x > widest ? x : widest;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "FileReader.h"
+#include <stdexcept>
+#include <cstring>
+
+FileReader::FileReader(const std::string& path, size_t chunkSize)
+	: _file(fopen(path.c_str(), "rb"))
+	, _path(path)
+	, _buffer(chunkSize ? chunkSize : 1)
+	, _pos(0)
+	, _end(0)
+	, _consumed(0)
+	, _size(0)
+{
+	if (!_file)
+		throw std::runtime_error("Failed to open " + path);
+
+	if (fseek(_file, 0, SEEK_END) == 0)
+	{
+		long size = ftell(_file);
+		_size = size > 0 ? (uint64_t)size : 0;
+	}
+	fseek(_file, 0, SEEK_SET);
+}
+
+FileReader::~FileReader()
+{
+	fclose(_file);
+}
+
+bool FileReader::_fill()
+{
+	_consumed += _end;
+	_pos = 0;
+	_end = fread(_buffer.data(), 1, _buffer.size(), _file);
+	if (_end == 0 && ferror(_file))
+		throw std::runtime_error("Failed to read " + _path);
+	return _end != 0;
+}
+
+bool FileReader::ReadLine(std::string& line)
+{
+	line.clear();
+	bool any = false;
+	for (;;)
+	{
+		if (_pos == _end && !_fill())
+			break;
+
+		any = true;
+		const char* start = &_buffer[_pos];
+		const char* nl = (const char*)memchr(start, '\n', _end - _pos);
+		if (nl)
+		{
+			line.append(start, nl - start);
+			_pos += nl - start + 1;
+			break;
+		}
+		line.append(start, _end - _pos);
+		_pos = _end;
+	}
+
+	if (!line.empty() && line.back() == '\r')
+		line.pop_back();
+	return any;
+}
+
+size_t FileReader::Read(void* data, size_t size)
+{
+	char* dst = (char*)data;
+	size_t done = 0;
+	while (done < size)
+	{
+		if (_pos == _end && !_fill())
+			break;
+
+		size_t n = _end - _pos;
+		n = n < size - done ? n : size - done;
+		memcpy(dst + done, &_buffer[_pos], n);
+		_pos += n;
+		done += n;
+	}
+	return done;
+}
+
+uint64_t FileReader::GetConsumed() const
+{
+	return _consumed + _pos;
+}
+
+uint64_t FileReader::GetSize() const
+{
+	return _size;
+}
+
+const std::string& FileReader::GetPath() const
+{
+	return _path;
+}
\ No newline at end of file
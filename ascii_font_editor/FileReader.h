@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+//Buffered file input, the counterpart of FileWriter.
+//The file is read in fixed chunks, memory use does not depend on the size of the file.
+class FileReader
+{
+private:
+	FILE*				_file;
+	std::string			_path;
+	std::vector<char>	_buffer;
+	size_t				_pos;
+	size_t				_end;
+	uint64_t			_consumed;
+	uint64_t			_size;
+
+	FileReader(FileReader&) = delete;
+	FileReader& operator=(FileReader&) = delete;
+
+	bool _fill();
+
+public:
+	explicit FileReader(const std::string& path, size_t chunkSize = 64 * 1024);
+	~FileReader();
+
+	//False at the end of the file
+	bool Get(char& c)
+	{
+		if (_pos == _end && !_fill())
+			return false;
+		c = _buffer[_pos++];
+		return true;
+	}
+
+	//Next line without its "\n" or "\r\n", false at the end of the file
+	bool ReadLine(std::string& line);
+	size_t Read(void* data, size_t size);
+
+	uint64_t GetConsumed() const;
+	uint64_t GetSize() const;
+	const std::string& GetPath() const;
+};
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "FileWriter.h"
+#include <stdexcept>
+#include <cstring>
+
+FileWriter::FileWriter(const std::string& path, size_t chunkSize)
+	: _file(fopen(path.c_str(), "wb"))
+	, _path(path)
+	, _buffer(chunkSize ? chunkSize : 1)
+	, _used(0)
+	, _written(0)
+{
+	if (!_file)
+		throw std::runtime_error("Failed to open " + path);
+}
+
+FileWriter::~FileWriter()
+{
+	if (_file)
+	{
+		if (_used)
+			fwrite(_buffer.data(), 1, _used, _file);
+		fclose(_file);
+	}
+}
+
+void FileWriter::_flush()
+{
+	if (!_file)
+		throw std::runtime_error("Write to closed file " + _path);
+
+	if (_used && fwrite(_buffer.data(), 1, _used, _file) != _used)
+		throw std::runtime_error("Failed to write " + _path);
+	_written += _used;
+	_used = 0;
+}
+
+void FileWriter::Write(const void* data, size_t size)
+{
+	const char* src = (const char*)data;
+	while (size)
+	{
+		if (_used == _buffer.size())
+			_flush();
+
+		size_t n = _buffer.size() - _used;
+		n = n < size ? n : size;
+		memcpy(&_buffer[_used], src, n);
+		_used += n;
+		src += n;
+		size -= n;
+	}
+}
+
+void FileWriter::Write(const std::string& str)
+{
+	Write(str.data(), str.size());
+}
+
+void FileWriter::Flush()
+{
+	_flush();
+	if (fflush(_file) != 0)
+		throw std::runtime_error("Failed to write " + _path);
+}
+
+void FileWriter::Close()
+{
+	if (!_file)
+		return;
+
+	_flush();
+	FILE* file = _file;
+	_file = nullptr;
+	if (fclose(file) != 0)
+		throw std::runtime_error("Failed to write " + _path);
+}
+
+uint64_t FileWriter::GetWritten() const
+{
+	return _written + _used;
+}
+
+const std::string& FileWriter::GetPath() const
+{
+	return _path;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+//Buffered file output.
+//Writes collect in a fixed buffer that goes to disk in whole chunks every time it fills,
+//memory use does not depend on the size of the file.
+//Close reports write errors, the destructor closes silently.
+class FileWriter
+{
+private:
+	FILE*				_file;
+	std::string			_path;
+	std::vector<char>	_buffer;
+	size_t				_used;
+	uint64_t			_written;
+
+	FileWriter(FileWriter&) = delete;
+	FileWriter& operator=(FileWriter&) = delete;
+
+	void _flush();
+
+public:
+	explicit FileWriter(const std::string& path, size_t chunkSize = 64 * 1024);
+	~FileWriter();
+
+	void Put(char c)
+	{
+		if (_used == _buffer.size())
+			_flush();
+		_buffer[_used++] = c;
+	}
+
+	void Write(const void* data, size_t size);
+	void Write(const std::string& str);
+	void Flush();
+	void Close();
+
+	uint64_t GetWritten() const;
+	const std::string& GetPath() const;
+};
\ No newline at end of file
@@ -1,37 +1,63 @@
 #include "Font.h"
-#include <Windows.h>
 #include <stdexcept>
 #include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <cctype>
 #include "reutils.h"
 #include "Utils.h"
 
 Font::Font(const std::string& pathToTxtFont)
+	: _utf8(false)
 {
-	HANDLE hFile = CreateFileA(pathToTxtFont.c_str(), GENERIC_READ,
-		FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
-	if (hFile == NULL || hFile == INVALID_HANDLE_VALUE)
+	std::ifstream file(pathToTxtFont, std::ios::binary);
+	if (!file)
 		throw std::runtime_error("Failed to open font file");
 
-	DWORD dwWritten = 0, dwSize = GetFileSize(hFile, NULL);
-	char* buf = new char[dwSize + 1];
-	if (!ReadFile(hFile, buf, dwSize, &dwWritten, NULL))
-	{
-		CloseHandle(hFile);
+	std::string fileContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (file.bad())
 		throw std::runtime_error("Failed to read file");
-	}
-	CloseHandle(hFile);
-	buf[dwSize] = '\0';
+	file.close();
+
+	_parseText(fileContent);
+}
+
+Font Font::makeFromText(std::string content)
+{
+	Font font;
+	font._parseText(content);
+	return font;
+}
 
-	std::string fileContent = buf;
-	delete[] buf;
+void Font::_parseText(std::string& fileContent)
+{
 	RemoveBOMFromString(fileContent);
-	auto match = reu::Search(fileContent, "^([0-9]+)x([0-9]+)\\r{0,1}\\n\\[(.+)\\]\\r{0,1}\\ni([0-9]{1,2})\\r{0,1}\\n");
-	if (!match.IsMatching())
+
+	//Header is the "WxH", "[sequence]" and "iN" lines. Only the short lines go through std::regex,
+	//its matcher recurses per character and overflows the stack on long UTF-8 sequences.
+	std::string header[3];
+	size_t pos = 0;
+	for (auto& line : header)
+	{
+		size_t end = fileContent.find('\n', pos);
+		if (end == std::string::npos)
+			throw std::runtime_error("Font file has invalid format");
+
+		line = fileContent.substr(pos, end - pos);
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		pos = end + 1;
+	}
+
+	auto dims = reu::Search(header[0], "^([0-9]+)x([0-9]+)$");
+	auto interval = reu::Search(header[2], "^i([0-9]{1,2})$");
+	if (!dims.IsMatching() || !interval.IsMatching() ||
+		header[1].length() < 2 || header[1].front() != '[' || header[1].back() != ']')
 		throw std::runtime_error("Font file has invalid format");
 
-	_width = std::atoi(match[1].c_str());
-	_height = std::atoi(match[2].c_str());
-	_interval = std::atoi(match[4].c_str());
+	_width = std::atoi(dims[1].c_str());
+	_height = std::atoi(dims[2].c_str());
+	_interval = std::atoi(interval[1].c_str());
 
 	if (_width <= 0 || _height <= 0)
 		throw std::runtime_error("Invalid font resolution");
@@ -39,14 +65,15 @@ Font::Font(const std::string& pathToTxtFont)
 	if (_interval < 0 || _interval > _width)
 		throw std::runtime_error("Invalid interval value");
 
-	for (size_t i = match.End() + 1; i < fileContent.length(); i++)
+	_dict.reserve(fileContent.length() - pos);
+	for (size_t i = pos; i < fileContent.length(); i++)
 		_dict.push_back(fileContent[i] == '0' ? 0 : 1);
 
 	auto count = _dict.size() / (_width * _height);
 
 	if (count == 0)
 		throw std::runtime_error("Font character count is zero");
-	_parseSequence(match[3], count);
+	_parseSequence(header[1].substr(1, header[1].length() - 2), count);
 
 	if (_dict.size() % (_width * _height) != 0)
 		throw std::runtime_error("Font is corrupted or has wrong resolution");
@@ -116,10 +143,19 @@ Font::Font(const std::vector<unsigned char>& dict, int h, int w, int interval, c
 		_dict.push_back(c == '0' ? 0 : 1);
 }
 
+Font::Font()
+	: _height(0)
+	, _width(0)
+	, _interval(0)
+	, _utf8(false)
+{
+}
+
 Font::Font(const Font& copy)
 	: _dict(copy._dict)
 	, _height(copy._height)
 	, _width(copy._width)
+	, _interval(copy._interval)
 	, _seq(copy._seq)
 	, _utf8(copy._utf8)
 {
@@ -130,6 +166,7 @@ Font& Font::operator=(const Font& copy)
 	_dict = copy._dict;
 	_height = copy._height;
 	_width = copy._width;
+	_interval = copy._interval;
 	_seq = copy._seq;
 	_utf8 = copy._utf8;
 	return *this;
@@ -141,6 +178,15 @@ Font::~Font()
 
 void Font::_parseSequence(std::string seq, size_t count)
 {
+	bool utf8 = false;
+	_seq = parseSequence(seq, count, utf8);
+	if (utf8)
+		_utf8 = true;
+}
+
+std::vector<utf8char_t> Font::parseSequence(std::string seq, size_t count, bool& utf8)
+{
+	std::vector<utf8char_t> codes;
 	if (seq.empty())
 	{
 		std::stringstream ss;
@@ -148,10 +194,10 @@ void Font::_parseSequence(std::string seq, size_t count)
 		seq = ss.str();
 	}
 
-	if (!reu::IsMatching(seq, "^[0-9a-fA-Fx\\ \\,\\-]+$"))
+	if (seq.find_first_not_of("0123456789abcdefABCDEFx ,-") != std::string::npos)
 		throw std::runtime_error("Font alphabet sequence has invalid format");
 
-	seq.erase(remove_if(seq.begin(), seq.end(), isspace), seq.end());
+	seq.erase(std::remove_if(seq.begin(), seq.end(), [](char c) { return std::isspace((unsigned char)c) != 0; }), seq.end());
 	std::stringstream ss;
 	std::string str;
 
@@ -169,7 +215,7 @@ void Font::_parseSequence(std::string seq, size_t count)
 		return ch;
 	};
 
-	bool utf8 = false;
+	utf8 = false;
 	ss << seq;
 	while (std::getline(ss, str, ','))
 	{
@@ -192,18 +238,46 @@ void Font::_parseSequence(std::string seq, size_t count)
 				utf8 = true;
 
 			for (utf8char_t i = lower; i <= higher; i++)
-				_seq.push_back(i);
+				codes.push_back(i);
 		}
 		else if (reu::IsMatching(str, "^([0-9a-fA-Fx]+)$"))
 		{
 			auto ch = str2uch(str);
 			if (ch > 255)
 				utf8 = true;
-			_seq.push_back(str2uch(str));
+			codes.push_back(str2uch(str));
 		}
 		else
 			throw std::runtime_error("Font alphabet sequence has invalid format");
 	}
+	return codes;
+}
+
+Font Font::makeFromBits(std::vector<unsigned char>&& bits, int h, int w, int interval, std::vector<utf8char_t>&& seq, bool utf8)
+{
+	if (w <= 0 || h <= 0)
+		throw std::runtime_error("Invalid font resolution");
+
+	if (bits.size() % (w * h) != 0)
+		throw std::runtime_error("Font is corrupted or has wrong resolution");
+
+	if (interval < 0 || interval > w)
+		throw std::runtime_error("Invalid interval value");
+
+	if (bits.empty())
+		throw std::runtime_error("Font character count is zero");
+
+	if (!seq.empty() && bits.size() / (w * h) != seq.size())
+		throw std::runtime_error("Font character count not matching font character sequence.");
+
+	Font font;
+	font._dict = std::move(bits);
+	font._height = h;
+	font._width = w;
+	font._interval = interval;
+	font._seq = std::move(seq);
+	font._utf8 = utf8;
+	return font;
 }
 
 int Font::GetHeight() const
@@ -227,6 +301,7 @@ Font Font::makeEmptyFont(int h, int w, int count, const std::string& seq)
 //Each pixel is a byte
 bitmap_t Font::GetCharImage_8bit(utf8char_t ch, bool monospace) const
 {
+	AllocScope scope(AllocTag::Font);
 	auto adaptiveSpace = [](bitmap_t& ch)
 	{
 		int emptyFirst = 0, emptyLast = 0;
@@ -392,6 +467,7 @@ bitmap_t Font::GetCharImage_8bit(utf8char_t ch, bool monospace) const
 
 bitmap_t Font::getFontTable(int maxColumn) const
 {
+	AllocScope scope(AllocTag::Font);
 	bitmap_t font;
 	int h, w, count = (int)CharCount();
 	int rows = count / maxColumn;
@@ -461,7 +537,22 @@ std::vector<utf8char_t> Font::GetAllSupportedChars() const
 	return _seq;
 }
 
+const std::vector<utf8char_t>& Font::GetSequence() const
+{
+	return _seq;
+}
+
+const std::vector<unsigned char>& Font::GetBits() const
+{
+	return _dict;
+}
+
 int Font::GetInterval() const
 {
 	return _interval;
+}
+
+bool Font::IsUTF8() const
+{
+	return _utf8;
 }
\ No newline at end of file
@@ -13,7 +13,9 @@ private:
 	std::vector<utf8char_t>			_seq;	//Empty associated char sequence means font is 0-255 ASCII representation
 	bool							_utf8;
 
+	Font();
 	void _parseSequence(std::string seq, size_t count);
+	void _parseText(std::string& content);
 
 public:
 	Font(const std::string& pathToTxtFont);
@@ -21,9 +23,16 @@ public:
 	Font(const std::vector<unsigned char>& dict, int h, int w, int interval, const std::vector<utf8char_t>& seq, bool utf8 = false);
 	Font(const Font& copy);
 	Font& operator=(const Font& copy);
+	Font(Font&& other) noexcept = default;
+	Font& operator=(Font&& other) noexcept = default;
 	~Font();
 
 	static Font makeEmptyFont(int h, int w, int count, const std::string& seq = "");
+	static Font makeFromText(std::string content);
+	//Adopts a dictionary of 0/1 pixels (not '0'/'1' characters) without copying it
+	static Font makeFromBits(std::vector<unsigned char>&& bits, int h, int w, int interval, std::vector<utf8char_t>&& seq, bool utf8);
+	//Codes of a "[sequence]" line such as "32-127, 0x41", empty means 0..count-1. utf8 tells whether a code exceeds a byte.
+	static std::vector<utf8char_t> parseSequence(std::string seq, size_t count, bool& utf8);
 
 	bitmap_t operator[](utf8char_t сh) const;
 
@@ -33,5 +42,8 @@ public:
 	bitmap_t GetCharImage_8bit(utf8char_t ch, bool monospace = true) const;
 	bitmap_t getFontTable(int maxColumn) const;
 	size_t CharCount() const;
+	bool IsUTF8() const;
 	std::vector<utf8char_t> GetAllSupportedChars() const;
+	const std::vector<utf8char_t>& GetSequence() const;
+	const std::vector<unsigned char>& GetBits() const;
 };
\ No newline at end of file
@@ -0,0 +1,287 @@
+#include "FontAtlas.h"
+#include "SkylinePacker.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cstdio>
+
+struct InkBox
+{
+	int left;
+	int top;
+	int right;	//Exclusive, equals left for blank glyphs
+	int bottom;
+};
+
+static InkBox findInk(const unsigned char* glyph, int w, int h)
+{
+	InkBox box = { w, h, 0, 0 };
+	for (int y = 0; y < h; y++)
+	{
+		for (int x = 0; x < w; x++)
+		{
+			if (glyph[y * w + x] == 0)
+				continue;
+			box.left = Min(box.left, x);
+			box.right = Max(box.right, x + 1);
+			box.top = Min(box.top, y);
+			box.bottom = Max(box.bottom, y + 1);
+		}
+	}
+	if (box.right == 0)
+		box = { 0, 0, 0, 0 };
+	return box;
+}
+
+//(id, glyph) pairs sorted by id, of duplicate codes the first glyph wins
+static std::vector<std::pair<uint32_t, size_t>> collectIds(const Font& font, size_t count)
+{
+	auto& seq = font.GetSequence();
+	std::vector<std::pair<uint32_t, size_t>> ids;
+	if (seq.empty())
+	{
+		for (size_t g = 0; g < count; g++)
+			ids.push_back({ (uint32_t)g, g });
+		return ids;
+	}
+
+	for (size_t i = 0; i < seq.size() && i < count; i++)
+		ids.push_back({ font.IsUTF8() ? utf8char_to_codepoint(seq[i]) : (uint32_t)seq[i], i });
+	std::stable_sort(ids.begin(), ids.end(), [](auto& a, auto& b) { return a.first < b.first; });
+	ids.erase(std::unique(ids.begin(), ids.end(), [](auto& a, auto& b) { return a.first == b.first; }), ids.end());
+	return ids;
+}
+
+static int nextPowerOfTwo(int v)
+{
+	int p = 1;
+	while (p < v)
+		p *= 2;
+	return p;
+}
+
+FontAtlas buildFontAtlas(const Font& font, const AtlasOptions& options)
+{
+	if (options.padding < 0 || options.spacing < 0)
+		throw std::runtime_error("Atlas padding and spacing can't be negative");
+
+	int fw = font.GetWidth(), fh = font.GetHeight();
+	size_t glyphBits = size_t(fw) * fh;
+	auto& bits = font.GetBits();
+	size_t count = glyphBits ? bits.size() / glyphBits : 0;
+	auto ids = collectIds(font, count);
+
+	FontAtlas atlas;
+	atlas.options = options;
+	atlas.lineHeight = fh + 1;
+	atlas.base = fh;
+	atlas.unicode = font.IsUTF8() || font.GetSequence().empty();
+
+	//Every reachable glyph is packed once
+	std::vector<InkBox> ink(count);
+	std::vector<bool> seen(count, false);
+	std::vector<size_t> order;
+	int pad = options.padding, gap = options.spacing;
+	int64_t area = 0;
+	int widest = 1, tallest = 1;
+	for (auto& id : ids)
+	{
+		size_t g = id.second;
+		if (seen[g])
+			continue;
+		seen[g] = true;
+		ink[g] = findInk(&bits[g * glyphBits], fw, fh);
+		if (ink[g].right == ink[g].left)
+			continue;
+
+		int w = ink[g].right - ink[g].left + 2 * pad + gap;
+		int h = ink[g].bottom - ink[g].top + 2 * pad + gap;
+		area += int64_t(w) * h;
+		widest = Max(widest, w);
+		tallest = Max(tallest, h);
+		order.push_back(g);
+	}
+
+	//Tall rectangles first, the skyline stays flat and short ones fill what is left
+	std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
+	{
+		int ha = ink[a].bottom - ink[a].top, hb = ink[b].bottom - ink[b].top;
+		if (ha != hb)
+			return ha > hb;
+		int wa = ink[a].right - ink[a].left, wb = ink[b].right - ink[b].left;
+		return wa != wb ? wa > wb : a < b;
+	});
+
+	//Smallest power of two page that can hold the area, doubled until everything fits
+	int pw = nextPowerOfTwo(widest), ph = nextPowerOfTwo(tallest);
+	while (int64_t(pw) * ph < area)
+	{
+		if (pw <= ph)
+			pw *= 2;
+		else
+			ph *= 2;
+	}
+
+	std::vector<int> px(count), py(count);
+	SkylinePacker packer(pw, ph);
+	for (;;)
+	{
+		if (pw > options.maxSize || ph > options.maxSize)
+			throw std::runtime_error("Glyphs do not fit a " + std::to_string(options.maxSize) + " pixel atlas");
+
+		bool packed = true;
+		for (size_t g : order)
+		{
+			int w = ink[g].right - ink[g].left + 2 * pad + gap;
+			int h = ink[g].bottom - ink[g].top + 2 * pad + gap;
+			if (!packer.Insert(w, h, px[g], py[g]))
+			{
+				packed = false;
+				break;
+			}
+		}
+		if (packed)
+			break;
+
+		if (pw <= ph)
+			pw *= 2;
+		else
+			ph *= 2;
+		packer.Reset(pw, ph);
+	}
+
+	InitBitmap(atlas.image, ph, pw);
+	for (size_t g : order)
+	{
+		auto& box = ink[g];
+		const unsigned char* src = &bits[g * glyphBits];
+		for (int y = box.top; y < box.bottom; y++)
+		{
+			pixel_t* dst = &atlas.image[py[g] + pad + y - box.top][px[g] + pad];
+			for (int x = box.left; x < box.right; x++)
+				dst[x - box.left] = src[y * fw + x] != 0 ? 1 : 0;
+		}
+	}
+
+	for (auto& id : ids)
+	{
+		size_t g = id.second;
+		auto& box = ink[g];
+		AtlasGlyph glyph = { id.first, 0, 0, 0, 0, 0, 0, fw + font.GetInterval() };
+		if (box.right != box.left)
+		{
+			glyph.x = px[g];
+			glyph.y = py[g];
+			glyph.width = box.right - box.left + 2 * pad;
+			glyph.height = box.bottom - box.top + 2 * pad;
+			glyph.xoffset = (options.monospace ? box.left : 0) - pad;
+			glyph.yoffset = box.top - pad;
+			if (!options.monospace)
+				glyph.xadvance = box.right - box.left + font.GetInterval();
+		}
+		atlas.glyphs.push_back(glyph);
+	}
+	return atlas;
+}
+
+static std::string faceName(const std::string& face)
+{
+	std::string name = face;
+	name.erase(std::remove(name.begin(), name.end(), '"'), name.end());
+	return name;
+}
+
+//The atlas is one white on black coverage page, every channel holds the glyphs
+void writeBMFontText(FileWriter& out, const FontAtlas& atlas, const std::string& face, const std::string& pageFile)
+{
+	char buf[256];
+	int pad = atlas.options.padding, gap = atlas.options.spacing;
+	out.Write("info face=\"" + faceName(face) + "\"");
+	snprintf(buf, sizeof(buf), " size=%d bold=0 italic=0 charset=\"\" unicode=%d stretchH=100 smooth=0 aa=1 padding=%d,%d,%d,%d spacing=%d,%d outline=0\n",
+		atlas.base, atlas.unicode ? 1 : 0, pad, pad, pad, pad, gap, gap);
+	out.Write(buf);
+	snprintf(buf, sizeof(buf), "common lineHeight=%d base=%d scaleW=%d scaleH=%d pages=1 packed=0 alphaChnl=0 redChnl=0 greenChnl=0 blueChnl=0\n",
+		atlas.lineHeight, atlas.base, atlas.image.empty() ? 0 : (int)atlas.image[0].size(), (int)atlas.image.size());
+	out.Write(buf);
+	out.Write("page id=0 file=\"" + pageFile + "\"\n");
+	snprintf(buf, sizeof(buf), "chars count=%zu\n", atlas.glyphs.size());
+	out.Write(buf);
+
+	for (auto& g : atlas.glyphs)
+	{
+		snprintf(buf, sizeof(buf), "char id=%u x=%d y=%d width=%d height=%d xoffset=%d yoffset=%d xadvance=%d page=0 chnl=15\n",
+			g.id, g.x, g.y, g.width, g.height, g.xoffset, g.yoffset, g.xadvance);
+		out.Write(buf);
+	}
+}
+
+static void putLE(std::vector<unsigned char>& out, uint32_t v, int bytes)
+{
+	for (int i = 0; i < bytes; i++)
+		out.push_back((v >> (8 * i)) & 0xFF);
+}
+
+static void writeBlock(FileWriter& out, int type, const std::vector<unsigned char>& data)
+{
+	std::vector<unsigned char> header;
+	putLE(header, (uint32_t)type, 1);
+	putLE(header, (uint32_t)data.size(), 4);
+	out.Write(header.data(), header.size());
+	out.Write(data.data(), data.size());
+}
+
+//Version 3 of the binary format, little endian blocks of type, size and payload
+void writeBMFontBinary(FileWriter& out, const FontAtlas& atlas, const std::string& face, const std::string& pageFile)
+{
+	int pw = atlas.image.empty() ? 0 : (int)atlas.image[0].size(), ph = (int)atlas.image.size();
+	if (pw > 0xFFFF || ph > 0xFFFF || atlas.options.padding > 0xFF || atlas.options.spacing > 0xFF)
+		throw std::runtime_error("Atlas does not fit the binary BMFont limits");
+
+	out.Write("BMF\x03", 4);
+
+	std::vector<unsigned char> info;
+	putLE(info, (uint32_t)atlas.base, 2);
+	putLE(info, atlas.unicode ? 0x02 : 0x00, 1);
+	putLE(info, 0, 1);		//Charset
+	putLE(info, 100, 2);	//Stretch
+	putLE(info, 1, 1);		//Supersampling
+	for (int i = 0; i < 4; i++)
+		putLE(info, (uint32_t)atlas.options.padding, 1);
+	putLE(info, (uint32_t)atlas.options.spacing, 1);
+	putLE(info, (uint32_t)atlas.options.spacing, 1);
+	putLE(info, 0, 1);		//Outline
+	std::string name = faceName(face);
+	info.insert(info.end(), name.begin(), name.end());
+	info.push_back(0);
+	writeBlock(out, 1, info);
+
+	std::vector<unsigned char> common;
+	putLE(common, (uint32_t)atlas.lineHeight, 2);
+	putLE(common, (uint32_t)atlas.base, 2);
+	putLE(common, (uint32_t)pw, 2);
+	putLE(common, (uint32_t)ph, 2);
+	putLE(common, 1, 2);	//Pages
+	putLE(common, 0, 1);
+	putLE(common, 0, 4);	//Alpha, red, green, blue hold the glyphs
+	writeBlock(out, 2, common);
+
+	std::vector<unsigned char> pages(pageFile.begin(), pageFile.end());
+	pages.push_back(0);
+	writeBlock(out, 3, pages);
+
+	std::vector<unsigned char> chars;
+	chars.reserve(atlas.glyphs.size() * 20);
+	for (auto& g : atlas.glyphs)
+	{
+		putLE(chars, g.id, 4);
+		putLE(chars, (uint32_t)g.x, 2);
+		putLE(chars, (uint32_t)g.y, 2);
+		putLE(chars, (uint32_t)g.width, 2);
+		putLE(chars, (uint32_t)g.height, 2);
+		putLE(chars, (uint32_t)g.xoffset, 2);
+		putLE(chars, (uint32_t)g.yoffset, 2);
+		putLE(chars, (uint32_t)g.xadvance, 2);
+		putLE(chars, 0, 1);		//Page
+		putLE(chars, 15, 1);	//All channels
+	}
+	writeBlock(out, 4, chars);
+}
\ No newline at end of file
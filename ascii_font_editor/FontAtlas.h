@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Font.h"
+#include "FileWriter.h"
+
+//Texture atlas of a font for GPU text rendering, with BMFont (AngelCode) metrics.
+//Glyphs are cut down to their ink and packed by SkylinePacker into a power of two page.
+//Proportional atlases advance by the ink width like the editor's non-monospace layout,
+//monospace ones keep the ink at its cell offset and advance by the full cell.
+//Blank glyphs take no atlas space, only their advance.
+struct AtlasOptions
+{
+	bool	monospace = false;
+	int		padding = 0;	//Empty border around each glyph, included in its rectangle
+	int		spacing = 1;	//Empty pixels between rectangles
+	int		maxSize = 16384;
+};
+
+struct AtlasGlyph
+{
+	uint32_t	id;			//Unicode code point, byte value for 8-bit fonts with a sequence
+	int			x;
+	int			y;
+	int			width;
+	int			height;
+	int			xoffset;
+	int			yoffset;
+	int			xadvance;
+};
+
+struct FontAtlas
+{
+	bitmap_t				image;
+	std::vector<AtlasGlyph>	glyphs;	//Sorted by id
+	AtlasOptions			options;
+	int						lineHeight = 0;
+	int						base = 0;
+	bool					unicode = false;
+};
+
+FontAtlas buildFontAtlas(const Font& font, const AtlasOptions& options);
+void writeBMFontText(FileWriter& out, const FontAtlas& atlas, const std::string& face, const std::string& pageFile);
+void writeBMFontBinary(FileWriter& out, const FontAtlas& atlas, const std::string& face, const std::string& pageFile);
\ No newline at end of file
@@ -0,0 +1,396 @@
+#include "FontIO.h"
+#include "ImageWriter.h"
+#include "PsfFont.h"
+#include "BdfFont.h"
+#include "FileWriter.h"
+#include <stdexcept>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+static const char s_packedMagic[4] = { 'F', 'N', 'T', 'B' };
+static const uint32_t s_packedVersion = 1;
+static const size_t s_packedHeader = 4 + 7 * 4;
+
+static void putLE32(std::vector<unsigned char>& out, uint32_t v)
+{
+	out.push_back(v & 0xFF);
+	out.push_back((v >> 8) & 0xFF);
+	out.push_back((v >> 16) & 0xFF);
+	out.push_back((v >> 24) & 0xFF);
+}
+
+static uint32_t getLE32(const unsigned char* p)
+{
+	return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+//Consecutive codes become "a-b" ranges, lone codes are written as hex
+std::string makeSequenceString(const std::vector<utf8char_t>& seq)
+{
+	std::stringstream ss;
+	for (size_t start = 0; start < seq.size();)
+	{
+		size_t end = start;
+		while (end + 1 < seq.size() && seq[end + 1] == seq[end] + 1)
+			end++;
+
+		if (start > 0)
+			ss << ", ";
+		if (end > start)
+			ss << seq[start] << "-" << seq[end];
+		else
+			ss << "0x" << std::hex << std::uppercase << seq[start] << std::dec;
+		start = end + 1;
+	}
+	return ss.str();
+}
+
+std::string makeFontHeader(int w, int h, int interval, const std::vector<utf8char_t>& seq)
+{
+	std::stringstream ss;
+	ss << w << "x" << h << "\n";
+	ss << "[" << makeSequenceString(seq) << "]\n";
+	ss << "i" << interval << "\n";
+	return ss.str();
+}
+
+std::vector<unsigned char> packGlyphTable(const bitmap_t& table, const CellGeometry& geom)
+{
+	int w = geom.CellWidth(), h = geom.CellHeight();
+	size_t glyphBytes = (size_t(w) * h + 7) / 8;
+	std::vector<unsigned char> packed(size_t(geom.Count()) * glyphBytes, 0);
+	for (int i = 0; i < geom.Count(); i++)
+	{
+		int ox = geom.OriginX(i), oy = geom.OriginY(i);
+		if (oy + h > (int)table.size() || ox + w > (int)table[oy].size())
+			throw std::runtime_error("Font table is smaller than its cell layout");
+
+		unsigned char* dst = &packed[i * glyphBytes];
+		size_t bit = 0;
+		for (int y = 0; y < h; y++)
+		{
+			const pixel_t* row = &table[oy + y][ox];
+			for (int x = 0; x < w; x++, bit++)
+			{
+				if (row[x] != 0)
+					dst[bit / 8] |= 0x80 >> (bit % 8);
+			}
+		}
+	}
+	return packed;
+}
+
+std::vector<unsigned char> unpackGlyphBits(const unsigned char* packed, size_t count, int w, int h)
+{
+	size_t glyphBits = size_t(w) * h;
+	size_t glyphBytes = (glyphBits + 7) / 8;
+	std::vector<unsigned char> bits(count * glyphBits);
+	for (size_t g = 0; g < count; g++, packed += glyphBytes)
+	{
+		unsigned char* dst = &bits[g * glyphBits];
+		for (size_t i = 0; i < glyphBits; i++)
+			dst[i] = (packed[i / 8] >> (7 - i % 8)) & 1;
+	}
+	return bits;
+}
+
+static void writeText(FileWriter& out, const Font& font, const ProgressFn& progress)
+{
+	out.Write(makeFontHeader(font.GetWidth(), font.GetHeight(), font.GetInterval(), font.GetSequence()));
+
+	//Progress goes out once per chunk of pixels
+	const size_t step = 64 * 1024;
+	auto& bits = font.GetBits();
+	for (size_t start = 0; start < bits.size(); start += step)
+	{
+		size_t end = Min(start + step, bits.size());
+		for (size_t i = start; i < end; i++)
+			out.Put(bits[i] != 0 ? '1' : '0');
+		if (progress)
+			progress(end, bits.size());
+	}
+}
+
+static std::vector<unsigned char> encodeText(const Font& font)
+{
+	std::string header = makeFontHeader(font.GetWidth(), font.GetHeight(), font.GetInterval(), font.GetSequence());
+	std::vector<unsigned char> out(header.begin(), header.end());
+	auto& bits = font.GetBits();
+	out.reserve(out.size() + bits.size());
+	for (auto px : bits)
+		out.push_back(px != 0 ? '1' : '0');
+	return out;
+}
+
+static std::vector<unsigned char> encodePacked(const Font& font)
+{
+	auto& bits = font.GetBits();
+	auto& seq = font.GetSequence();
+	size_t glyphBits = size_t(font.GetWidth()) * font.GetHeight();
+	size_t glyphBytes = (glyphBits + 7) / 8;
+	size_t count = bits.size() / glyphBits;
+
+	std::vector<unsigned char> out(s_packedMagic, s_packedMagic + 4);
+	putLE32(out, s_packedVersion);
+	putLE32(out, (uint32_t)font.GetWidth());
+	putLE32(out, (uint32_t)font.GetHeight());
+	putLE32(out, (uint32_t)font.GetInterval());
+	putLE32(out, font.IsUTF8() ? 1 : 0);
+	putLE32(out, (uint32_t)count);
+	putLE32(out, (uint32_t)seq.size());
+	for (auto ch : seq)
+		putLE32(out, (uint32_t)ch);
+
+	size_t start = out.size();
+	out.resize(start + count * glyphBytes, 0);
+	for (size_t g = 0; g < count; g++)
+	{
+		unsigned char* dst = &out[start + g * glyphBytes];
+		const unsigned char* src = &bits[g * glyphBits];
+		for (size_t i = 0; i < glyphBits; i++)
+		{
+			if (src[i] != 0)
+				dst[i / 8] |= 0x80 >> (i % 8);
+		}
+	}
+	return out;
+}
+
+static Font decodePacked(const std::vector<unsigned char>& data)
+{
+	if (data.size() < s_packedHeader)
+		throw std::runtime_error("Packed font header is truncated");
+
+	const unsigned char* p = data.data() + 4;
+	uint32_t version = getLE32(p);
+	int w = (int)getLE32(p + 4);
+	int h = (int)getLE32(p + 8);
+	int interval = (int)getLE32(p + 12);
+	uint32_t flags = getLE32(p + 16);
+	size_t count = getLE32(p + 20);
+	size_t seqLen = getLE32(p + 24);
+
+	if (version != s_packedVersion)
+		throw std::runtime_error("Unsupported packed font version");
+
+	if (w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF)
+		throw std::runtime_error("Invalid font resolution");
+
+	size_t glyphBits = size_t(w) * h;
+	size_t glyphBytes = (glyphBits + 7) / 8;
+	if (seqLen > (data.size() - s_packedHeader) / 4 ||
+		count > (data.size() - s_packedHeader - seqLen * 4) / glyphBytes ||
+		data.size() != s_packedHeader + seqLen * 4 + count * glyphBytes)
+		throw std::runtime_error("Packed font size does not match its header");
+
+	std::vector<utf8char_t> seq(seqLen);
+	p = data.data() + s_packedHeader;
+	for (size_t i = 0; i < seqLen; i++, p += 4)
+		seq[i] = getLE32(p);
+
+	return Font::makeFromBits(unpackGlyphBits(p, count, w, h), h, w, interval, std::move(seq), (flags & 1) != 0);
+}
+
+std::vector<unsigned char> encodeFont(const Font& font, FontFormat format)
+{
+	switch (format)
+	{
+	case FontFormat::Packed:	return encodePacked(font);
+	case FontFormat::Psf1:		return encodePsf(font, 1);
+	case FontFormat::Psf2:		return encodePsf(font, 2);
+	case FontFormat::Bdf:		return encodeBdf(font, "fonted");
+	default:					return encodeText(font);
+	}
+}
+
+FontFormat detectFontFormat(const std::vector<unsigned char>& data)
+{
+	if (data.size() >= 4 && memcmp(data.data(), s_packedMagic, 4) == 0)
+		return FontFormat::Packed;
+	if (isBdf(data))
+		return FontFormat::Bdf;
+
+	switch (psfVersion(data))
+	{
+	case 1:		return FontFormat::Psf1;
+	case 2:		return FontFormat::Psf2;
+	default:	return FontFormat::Text;
+	}
+}
+
+Font decodeFont(const std::vector<unsigned char>& data)
+{
+	FontFormat format = detectFontFormat(data);
+	if (format == FontFormat::Packed)
+		return decodePacked(data);
+	if (format == FontFormat::Psf1 || format == FontFormat::Psf2)
+		return decodePsf(data);
+	if (format == FontFormat::Bdf)
+		return decodeBdf(data);
+
+	//The text parser lives in Font itself
+	return Font::makeFromText(std::string(data.begin(), data.end()));
+}
+
+std::vector<unsigned char> readFile(const std::string& path, const ProgressFn& progress)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		throw std::runtime_error("Failed to open " + path);
+
+	if (!progress)
+	{
+		std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		if (file.bad())
+			throw std::runtime_error("Failed to read " + path);
+		return data;
+	}
+
+	file.seekg(0, std::ios::end);
+	std::streamoff size = file.tellg();
+	file.seekg(0, std::ios::beg);
+	if (size < 0)
+		throw std::runtime_error("Failed to read " + path);
+
+	const size_t chunk = 1024 * 1024;
+	std::vector<unsigned char> data((size_t)size);
+	for (size_t done = 0; done < data.size();)
+	{
+		size_t n = Min(chunk, data.size() - done);
+		if (!file.read((char*)&data[done], n))
+			throw std::runtime_error("Failed to read " + path);
+		done += n;
+		progress(done, data.size());
+	}
+	return data;
+}
+
+Font loadFont(const std::string& path, const ProgressFn& progress)
+{
+	//BDF is parsed while it is read, the file never has to fit in memory
+	if (isBdfFile(path))
+		return readBdf(path, progress);
+	return decodeFont(readFile(path, progress));
+}
+
+void saveFont(const std::string& path, const Font& font, FontFormat format, const ProgressFn& progress)
+{
+	if (format == FontFormat::Bdf)
+	{
+		size_t slash = path.find_last_of("/\\");
+		std::string name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+		name = name.substr(0, name.find('.'));
+
+		FileWriter out(path);
+		writeBdf(out, font, name.empty() ? "fonted" : name, progress);
+		out.Close();
+		return;
+	}
+
+	if (format != FontFormat::Text)
+	{
+		writeFile(path, encodeFont(font, format));
+		if (progress)
+			progress(1, 1);
+		return;
+	}
+
+	//Text takes a byte per pixel, it goes out in chunks instead of one buffer
+	FileWriter out(path);
+	writeText(out, font, progress);
+	out.Close();
+}
+
+void savePackedGlyphs(const std::string& path, const unsigned char* packed, size_t count, int w, int h, int interval,
+	const std::vector<utf8char_t>& seq, bool utf8, FontFormat format, const ProgressFn& progress)
+{
+	if (format != FontFormat::Text && format != FontFormat::Packed)
+		throw std::runtime_error("Packed glyphs can only be saved as text or packed fonts");
+
+	size_t glyphBits = size_t(w) * h;
+	size_t glyphBytes = (glyphBits + 7) / 8;
+	FileWriter out(path);
+
+	if (format == FontFormat::Packed)
+	{
+		//The glyph bytes are already in the file layout, only the header is built here
+		std::vector<unsigned char> header(s_packedMagic, s_packedMagic + 4);
+		putLE32(header, s_packedVersion);
+		putLE32(header, (uint32_t)w);
+		putLE32(header, (uint32_t)h);
+		putLE32(header, (uint32_t)interval);
+		putLE32(header, utf8 ? 1 : 0);
+		putLE32(header, (uint32_t)count);
+		putLE32(header, (uint32_t)seq.size());
+		for (auto ch : seq)
+			putLE32(header, (uint32_t)ch);
+		out.Write(header.data(), header.size());
+	}
+	else
+		out.Write(makeFontHeader(w, h, interval, seq));
+
+	//Progress goes out once per chunk of glyphs
+	const size_t step = 1024;
+	for (size_t start = 0; start < count; start += step)
+	{
+		size_t end = Min(start + step, count);
+		if (format == FontFormat::Packed)
+			out.Write(packed + start * glyphBytes, (end - start) * glyphBytes);
+		else
+		{
+			for (size_t g = start; g < end; g++)
+			{
+				const unsigned char* src = packed + g * glyphBytes;
+				for (size_t i = 0; i < glyphBits; i++)
+					out.Put((src[i / 8] >> (7 - i % 8)) & 1 ? '1' : '0');
+			}
+		}
+		if (progress)
+			progress(end, count);
+	}
+	out.Close();
+}
+
+const char* fontFormatExtension(FontFormat format)
+{
+	switch (format)
+	{
+	case FontFormat::Packed:	return ".fntb";
+	case FontFormat::Psf1:
+	case FontFormat::Psf2:		return ".psf";
+	case FontFormat::Bdf:		return ".bdf";
+	default:					return ".fnt";
+	}
+}
+
+const char* fontFormatName(FontFormat format)
+{
+	switch (format)
+	{
+	case FontFormat::Packed:	return "fntb";
+	case FontFormat::Psf1:		return "psf1";
+	case FontFormat::Psf2:		return "psf2";
+	case FontFormat::Bdf:		return "bdf";
+	default:					return "fnt";
+	}
+}
+
+bool fontFormatFromName(const std::string& name, FontFormat& format)
+{
+	if (name == "text" || name == "fnt")
+		format = FontFormat::Text;
+	else if (name == "packed" || name == "fntb")
+		format = FontFormat::Packed;
+	else if (name == "psf" || name == "psf2")
+		format = FontFormat::Psf2;
+	else if (name == "psf1")
+		format = FontFormat::Psf1;
+	else if (name == "bdf")
+		format = FontFormat::Bdf;
+	else
+		return false;
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include "Font.h"
+#include "CellGeometry.h"
+
+//On-disk font formats.
+//Text (.fnt) is the editor format: "WxH", "[sequence]", "iN" and one '0'/'1' per pixel.
+//Packed (.fntb) is little endian: "FNTB", uint32 version, width, height, interval, flags (bit 0 utf8),
+//glyph count and sequence length, the sequence as uint32 values, then every glyph bit packed
+//row by row, MSB first, each glyph padded to a whole byte.
+//PSF1 and PSF2 are the Linux console formats, see PsfFont.h. BDF is the X11 format, see BdfFont.h.
+enum class FontFormat
+{
+	Text,
+	Packed,
+	Psf1,
+	Psf2,
+	Bdf
+};
+
+std::string makeSequenceString(const std::vector<utf8char_t>& seq);
+//Called with the amount of work done so far, may throw to abort the operation
+using ProgressFn = std::function<void(uint64_t done, uint64_t total)>;
+
+std::string makeFontHeader(int w, int h, int interval, const std::vector<utf8char_t>& seq);
+
+//Glyphs of every cell of a font table packed as in .fntb: row by row, MSB first, each glyph padded to a whole byte
+std::vector<unsigned char> packGlyphTable(const bitmap_t& table, const CellGeometry& geom);
+//0/1 pixels of count packed glyphs in the layout Font::makeFromBits takes
+std::vector<unsigned char> unpackGlyphBits(const unsigned char* packed, size_t count, int w, int h);
+
+std::vector<unsigned char> encodeFont(const Font& font, FontFormat format);
+Font decodeFont(const std::vector<unsigned char>& data);
+FontFormat detectFontFormat(const std::vector<unsigned char>& data);
+
+std::vector<unsigned char> readFile(const std::string& path, const ProgressFn& progress = nullptr);
+Font loadFont(const std::string& path, const ProgressFn& progress = nullptr);
+void saveFont(const std::string& path, const Font& font, FontFormat format, const ProgressFn& progress = nullptr);
+//Text or packed font written straight from count glyphs packed as in .fntb, no Font is built on the way
+void savePackedGlyphs(const std::string& path, const unsigned char* packed, size_t count, int w, int h, int interval,
+	const std::vector<utf8char_t>& seq, bool utf8, FontFormat format, const ProgressFn& progress = nullptr);
+const char* fontFormatExtension(FontFormat format);
+const char* fontFormatName(FontFormat format);
+bool fontFormatFromName(const std::string& name, FontFormat& format);
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "FontTableImage.h"
+#include "MenuFont.h"
+#include <stdexcept>
+#include <algorithm>
+#include <cstdio>
+
+enum TableColor : uint8_t
+{
+	ColorPaper,
+	ColorInk,
+	ColorGrid,
+	ColorEmpty,
+	ColorLabel
+};
+
+//Unicode code points for UTF-8 fonts, byte values otherwise
+static std::string codeLabel(const Font& font, size_t index)
+{
+	const auto& seq = font.GetSequence();
+	char text[16];
+	if (seq.empty())
+		snprintf(text, sizeof(text), "%02X", (unsigned)index);
+	else if (font.IsUTF8())
+		snprintf(text, sizeof(text), "%04X", (unsigned)utf8char_to_codepoint(seq[index]));
+	else
+		snprintf(text, sizeof(text), "%02X", (unsigned)seq[index]);
+	return text;
+}
+
+void writeFontTableImage(FileWriter& out, const Font& font, const TableImageOptions& options, ImageFormat format, const ProgressFn& progress)
+{
+	if (options.columns <= 0)
+		throw std::runtime_error("Invalid column count");
+	if (options.scale <= 0 || options.scale > 64)
+		throw std::runtime_error("Invalid scale");
+
+	const int w = font.GetWidth(), h = font.GetHeight(), scale = options.scale;
+	const auto& bits = font.GetBits();
+	//Same cell count as getFontTable, 8-bit fonts without a sequence always show 256 cells
+	const size_t count = font.CharCount();
+	const size_t glyphs = Min(bits.size() / (size_t(w) * h), count);
+	const int columns = options.columns;
+	const size_t rows = count <= size_t(columns) ? 1 : (count + columns - 1) / columns;
+
+	int labelW = 0, labelH = options.labels ? s_menuFont.GetHeight() : 0;
+	if (options.labels)
+	{
+		for (size_t i = 0; i < glyphs; i++)
+		{
+			int textW = (int)codeLabel(font, i).length() * s_menuFont.GetWidth();
+			labelW = Max(labelW, textW);
+		}
+	}
+
+	const int cellW = Max(w * scale, labelW), cellH = h * scale + labelH;
+	const int glyphX = (cellW - w * scale) / 2;
+	const uint64_t width = uint64_t(columns) * (cellW + 1) - 1, height = uint64_t(rows) * (cellH + 1) - 1;
+	if (width > 0x7FFFFFFF || height > 0x7FFFFFFF)
+		throw std::runtime_error("Table picture is too large");
+
+	ImageRowWriter writer(out, (int)width, (int)height, format, { options.paper, options.ink, options.grid, options.empty, options.label });
+	std::vector<uint8_t> line((size_t)width);
+	std::vector<std::string> labels(columns);
+
+	for (size_t r = 0; r < rows; r++)
+	{
+		for (int c = 0; c < columns; c++)
+		{
+			size_t index = r * columns + c;
+			labels[c] = options.labels && index < glyphs ? codeLabel(font, index) : std::string();
+		}
+
+		for (int y = 0; y <= cellH; y++)
+		{
+			if (y == cellH)
+			{
+				//Grid line between cell rows
+				if (r + 1 == rows)
+					break;
+				std::fill(line.begin(), line.end(), ColorGrid);
+				writer.WriteRow(line.data());
+				continue;
+			}
+
+			for (int c = 0; c < columns; c++)
+			{
+				uint8_t* dst = &line[size_t(c) * (cellW + 1)];
+				size_t index = r * columns + c;
+				if (c + 1 < columns)
+					dst[cellW] = ColorGrid;
+
+				if (index >= glyphs)
+				{
+					std::fill(dst, dst + cellW, ColorEmpty);
+					continue;
+				}
+
+				std::fill(dst, dst + cellW, ColorPaper);
+				if (y < h * scale)
+				{
+					const unsigned char* src = &bits[index * w * h + size_t(y / scale) * w];
+					for (int x = 0; x < w * scale; x++)
+						dst[glyphX + x] = src[x / scale] ? ColorInk : ColorPaper;
+				}
+				else
+				{
+					const std::string& text = labels[c];
+					int ly = y - h * scale, lx = (cellW - (int)text.length() * s_menuFont.GetWidth()) / 2;
+					for (size_t i = 0; i < text.length(); i++)
+					{
+						long glyph = s_menuFont.FindGlyph((unsigned char)text[i]);
+						for (int x = 0; x < s_menuFont.GetWidth(); x++)
+						{
+							if (glyph >= 0 && s_menuFont.Pixel(glyph, x, ly))
+								dst[lx + i * s_menuFont.GetWidth() + x] = ColorLabel;
+						}
+					}
+				}
+			}
+			writer.WriteRow(line.data());
+		}
+
+		if (progress && ((r & 0x3F) == 0x3F || r + 1 == rows))
+			progress(r + 1, rows);
+	}
+	writer.Finish();
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include "Font.h"
+#include "FontIO.h"
+#include "FileWriter.h"
+#include "ImageWriter.h"
+
+//Colors are 0xRRGGBB
+struct TableImageOptions
+{
+	int			columns = 16;
+	int			scale = 1;			//Glyph pixels only, grid lines stay 1px
+	bool		labels = true;		//Hex code under every glyph in the menu font
+	uint32_t	ink = 0x000000;
+	uint32_t	paper = 0xFFFFFF;
+	uint32_t	grid = 0x808080;
+	uint32_t	empty = 0xC0C0C0;	//Cells past the last glyph
+	uint32_t	label = 0x3050A0;
+};
+
+//The Font::getFontTable grid as a PNG or PPM picture for review, without the editor.
+//Pixel rows are generated and encoded one at a time, so tables of any size stay within a few rows of memory.
+//With scale 1 and no labels the picture matches getFontTable pixel for pixel.
+void writeFontTableImage(FileWriter& out, const Font& font, const TableImageOptions& options, ImageFormat format, const ProgressFn& progress = nullptr);
\ No newline at end of file
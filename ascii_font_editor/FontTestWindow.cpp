@@ -8,28 +8,30 @@
 #include "Font.h"
 #include "resource.h"
 #include "Utils.h"
+#include "Trace.h"
 
 static constexpr const int s_vOffset = 50;
 static constexpr const int s_hOffset = 50;
 
 void FontTestWindow::_draw()
 {
+	ArenaBinding arenaBinding(_frameArena);
 	while (_pw.isActive() && _testingFont)
 	{
+		TRACE_SCOPE("preview frame");
+		_frameArena.Reset();
+		_stats.BeginFrame();
 		_pw.makeCurrent();
 		_pw.pollEvents();
 		_pw.beginFrame();
 		_pw.setBackgroundColor(_backgroundColor);
+		_stats.Mark(FrameStats::Stage::Events);
 
-		for (int y = 0; y < Min(_height, _screen.size()); y++)
-		{
-			for (int x = 0; x < Min(_width, _screen[y].size()); x++)
-			{
-				if (_screen[y][x] > 0)
-					_pw.setPixel(x, y, _fontColor);
-			}
-		}
+		_screen.PresentMask(_pw, _fontColor, 1, _width, _height);
+		_stats.Mark(FrameStats::Stage::Compose);
 		_pw.endFrame();
+		_stats.Mark(FrameStats::Stage::Present);
+		_stats.EndFrame();
 	}
 	_pw.forceClose();
 }
@@ -74,6 +76,11 @@ void FontTestWindow::SwitchMonospace()
 	_screen.DrawTextRegular(_font, _text, s_hOffset, s_vOffset, 1, _invert, _monospace);
 }
 
+const FrameStats& FontTestWindow::GetFrameStats() const
+{
+	return _stats;
+}
+
 void FontTestWindow::SwitchInvert()
 {
 	_invert = !_invert;
@@ -2,6 +2,8 @@
 #include <PixelWindow/PixelWindow.h>
 #include <atomic>
 #include "VirtualCanvas.h"
+#include "FrameStats.h"
+#include "FrameArena.h"
 
 class Font;
 
@@ -19,6 +21,8 @@ private:
 	bool _monospace;
 	bool _invert;
 	std::atomic<bool>& _testingFont;
+	FrameStats _stats;
+	FrameArena _frameArena;
 
 	FontTestWindow(FontTestWindow&) = delete;
 	FontTestWindow& operator=(FontTestWindow&) = delete;
@@ -32,4 +36,5 @@ public:
 	~FontTestWindow();
 	void SwitchMonospace();
 	void SwitchInvert();
+	const FrameStats& GetFrameStats() const;
 };
\ No newline at end of file
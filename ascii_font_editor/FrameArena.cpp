@@ -0,0 +1,97 @@
+#include "FrameArena.h"
+#include "Utils.h"
+#include <cstdint>
+
+thread_local FrameArena* FrameArena::t_bound = nullptr;
+thread_local int FrameArena::t_transient = 0;
+
+FrameArena::FrameArena(size_t chunkSize)
+	: _current(0)
+	, _offset(0)
+	, _chunkSize(chunkSize)
+	, _used(0)
+	, _peak(0)
+{
+}
+
+void FrameArena::_grow(size_t bytes)
+{
+	size_t size = Max(bytes, _chunkSize);
+	_chunks.push_back({ std::unique_ptr<unsigned char[]>(new unsigned char[size]), size });
+	_current = _chunks.size() - 1;
+	_offset = 0;
+}
+
+void* FrameArena::Allocate(size_t bytes, size_t align)
+{
+	if (bytes == 0)
+		bytes = 1;
+
+	for (;;)
+	{
+		if (_current < _chunks.size())
+		{
+			Chunk& chunk = _chunks[_current];
+			uintptr_t base = (uintptr_t)chunk.data.get();
+			size_t start = ((base + _offset + align - 1) & ~(uintptr_t)(align - 1)) - base;
+			if (start + bytes <= chunk.size)
+			{
+				_offset = start + bytes;
+				_used += bytes;
+				return chunk.data.get() + start;
+			}
+		}
+
+		_grow(bytes + align);
+	}
+}
+
+bool FrameArena::Owns(const void* p) const
+{
+	const unsigned char* ptr = (const unsigned char*)p;
+	for (const Chunk& chunk : _chunks)
+	{
+		if (ptr >= chunk.data.get() && ptr < chunk.data.get() + chunk.size)
+			return true;
+	}
+	return false;
+}
+
+void FrameArena::Reset()
+{
+	_peak = Max(_peak, _used);
+
+	//A frame that spilled over into several chunks gets one chunk big enough for all of it,
+	//so the next frames bump through a single block without touching the heap
+	if (_chunks.size() > 1)
+	{
+		size_t total = 0;
+		for (const Chunk& chunk : _chunks)
+			total += chunk.size;
+
+		_chunks.clear();
+		_chunks.push_back({ std::unique_ptr<unsigned char[]>(new unsigned char[total]), total });
+	}
+
+	_current = 0;
+	_offset = 0;
+	_used = 0;
+}
+
+size_t FrameArena::GetUsed() const
+{
+	return _used;
+}
+
+size_t FrameArena::GetPeak() const
+{
+	return Max(_peak, _used);
+}
+
+size_t FrameArena::GetCapacity() const
+{
+	size_t total = 0;
+	for (const Chunk& chunk : _chunks)
+		total += chunk.size;
+	return total;
+}
\ No newline at end of file
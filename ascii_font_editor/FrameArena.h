@@ -0,0 +1,79 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+//Bump allocator for buffers that do not outlive a frame.
+//A render thread binds its arena with ArenaBinding and rewinds it with Reset at
+//the start of every frame. Code that builds short lived buffers opens a
+//TransientScope, TrackedAllocator then carves them from the bound arena instead
+//of the heap and their frees become no-ops.
+//Anything allocated inside a TransientScope must be gone before the next Reset.
+class FrameArena
+{
+private:
+	struct Chunk
+	{
+		std::unique_ptr<unsigned char[]>	data;
+		size_t								size;
+	};
+
+	std::vector<Chunk>	_chunks;
+	size_t				_current;	//Chunk being carved
+	size_t				_offset;	//First free byte of the current chunk
+	size_t				_chunkSize;
+	size_t				_used;
+	size_t				_peak;
+
+	static thread_local FrameArena*	t_bound;
+	static thread_local int			t_transient;
+
+	friend class ArenaBinding;
+	friend class TransientScope;
+
+	FrameArena(FrameArena&) = delete;
+	FrameArena& operator=(FrameArena&) = delete;
+
+	void _grow(size_t bytes);
+
+public:
+	explicit FrameArena(size_t chunkSize = 64 * 1024);
+
+	void* Allocate(size_t bytes, size_t align);
+	bool Owns(const void* p) const;
+	void Reset();
+
+	size_t GetUsed() const;
+	size_t GetPeak() const;		//Largest frame so far
+	size_t GetCapacity() const;
+
+	//Arena to allocate from, null outside a TransientScope or when no arena is bound
+	static FrameArena* Transient() { return t_transient > 0 ? t_bound : nullptr; }
+	static FrameArena* Bound() { return t_bound; }
+};
+
+//Binds an arena to the calling thread until the end of the scope
+class ArenaBinding
+{
+private:
+	FrameArena*	_prev;
+
+	ArenaBinding(ArenaBinding&) = delete;
+	ArenaBinding& operator=(ArenaBinding&) = delete;
+
+public:
+	ArenaBinding(FrameArena& arena) : _prev(FrameArena::t_bound) { FrameArena::t_bound = &arena; }
+	~ArenaBinding() { FrameArena::t_bound = _prev; }
+};
+
+//Routes tracked allocations of the calling thread to its bound arena until the end of the scope
+class TransientScope
+{
+private:
+	TransientScope(TransientScope&) = delete;
+	TransientScope& operator=(TransientScope&) = delete;
+
+public:
+	TransientScope() { FrameArena::t_transient++; }
+	~TransientScope() { FrameArena::t_transient--; }
+};
\ No newline at end of file
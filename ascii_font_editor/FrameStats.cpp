@@ -0,0 +1,137 @@
+#include "FrameStats.h"
+#include <cstring>
+#include <cstdio>
+
+FrameStats::FrameStats()
+{
+	memset(_frameUs, 0, sizeof(_frameUs));
+	Reset();
+}
+
+void FrameStats::BeginFrame()
+{
+	memset(_frameUs, 0, sizeof(_frameUs));
+	_frameStart = _stageStart = Clock::now();
+}
+
+void FrameStats::Mark(Stage stage)
+{
+	auto now = Clock::now();
+	_frameUs[(int)stage] += std::chrono::duration_cast<std::chrono::microseconds>(now - _stageStart).count();
+	_stageStart = now;
+}
+
+void FrameStats::EndFrame()
+{
+	uint64_t frameUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _frameStart).count();
+
+	std::lock_guard<std::mutex> guard(_lock);
+	for (int i = 0; i < Series; i++)
+	{
+		uint64_t us = i == (int)Stage::Count ? frameUs : _frameUs[i];
+		Histogram& hist = _hist[i];
+		hist.counts[_bucket(us)]++;
+		hist.total++;
+		if (us > hist.maxUs)
+			hist.maxUs = us;
+	}
+}
+
+void FrameStats::Reset()
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	memset(_hist, 0, sizeof(_hist));
+}
+
+int FrameStats::_bucket(uint64_t us)
+{
+	if (us < SubBuckets)
+		return (int)us;
+
+	int octave = 0;
+	while ((us >> octave) >= 2 * SubBuckets)
+		octave++;
+
+	int bucket = (octave + 1) * SubBuckets + int((us >> octave) - SubBuckets);
+	return bucket < Buckets ? bucket : Buckets - 1;
+}
+
+double FrameStats::_bucketUpperMs(int bucket)
+{
+	if (bucket < SubBuckets)
+		return (bucket + 1) / 1000.0;
+
+	int octave = bucket / SubBuckets - 1;
+	uint64_t base = uint64_t(SubBuckets + bucket % SubBuckets) << octave;
+	return (base + (uint64_t(1) << octave)) / 1000.0;
+}
+
+FrameStats::Summary FrameStats::_summarize(const Histogram& hist) const
+{
+	Summary sum = { 0.0, 0.0, hist.maxUs / 1000.0, (size_t)hist.total };
+	if (hist.total == 0)
+		return sum;
+
+	uint64_t p50 = (hist.total + 1) / 2, p99 = hist.total - hist.total / 100, seen = 0;
+	for (int i = 0; i < Buckets; i++)
+	{
+		seen += hist.counts[i];
+		if (sum.p50 == 0.0 && seen >= p50)
+			sum.p50 = _bucketUpperMs(i);
+		if (seen >= p99)
+		{
+			sum.p99 = _bucketUpperMs(i);
+			break;
+		}
+	}
+
+	//Bucket bounds overshoot, never report more than was measured
+	sum.p50 = sum.p50 < sum.max ? sum.p50 : sum.max;
+	sum.p99 = sum.p99 < sum.max ? sum.p99 : sum.max;
+	return sum;
+}
+
+FrameStats::Summary FrameStats::GetStage(Stage stage) const
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	return _summarize(_hist[(int)stage]);
+}
+
+FrameStats::Summary FrameStats::GetFrame() const
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	return _summarize(_hist[(int)Stage::Count]);
+}
+
+//One line per series: "name p50/p99 ms", stages that never took time are skipped
+std::string FrameStats::Format() const
+{
+	std::string str;
+	char buf[64];
+	for (int i = Series - 1; i >= 0; i--)
+	{
+		Summary sum = i == (int)Stage::Count ? GetFrame() : GetStage(Stage(i));
+		if (i != (int)Stage::Count && sum.max == 0.0)
+			continue;
+
+		snprintf(buf, sizeof(buf), "%-7s %.2f/%.2f", i == (int)Stage::Count ? "frame" : StageName(Stage(i)), sum.p50, sum.p99);
+		if (!str.empty())
+			str += "\n";
+		str += buf;
+	}
+	return str;
+}
+
+const char* FrameStats::StageName(Stage stage)
+{
+	switch (stage)
+	{
+	case Stage::Events:		return "events";
+	case Stage::Lock:		return "lock";
+	case Stage::Edits:		return "edits";
+	case Stage::Menu:		return "menu";
+	case Stage::Compose:	return "compose";
+	case Stage::Present:	return "present";
+	default:				return "?";
+	}
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <cstdint>
+
+//Per-stage frame timings of a render loop.
+//The render thread calls BeginFrame, Mark after every stage and EndFrame,
+//which costs one clock read per stage and a short lock per frame.
+//Durations go into log-scale histograms, any thread may read percentiles.
+class FrameStats
+{
+public:
+	enum class Stage
+	{
+		Events,		//pollEvents and menu state
+		Lock,		//Waiting for the workspace lock
+		Edits,		//Draining the edit queue
+		Menu,		//Menu bar presentation
+		Compose,	//Glyph layer and overlay presentation
+		Present,	//endFrame, buffer swap
+		Count
+	};
+
+	struct Summary
+	{
+		double	p50;	//Milliseconds
+		double	p99;
+		double	max;
+		size_t	frames;
+	};
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	//8 buckets per power of two of microseconds, up to about 16 seconds
+	static constexpr const int SubBuckets = 8;
+	static constexpr const int Buckets = 24 * SubBuckets;
+	static constexpr const int Series = (int)Stage::Count + 1;	//Stages and whole frames
+
+	struct Histogram
+	{
+		uint32_t	counts[Buckets];
+		uint64_t	total;
+		uint64_t	maxUs;
+	};
+
+	mutable std::mutex	_lock;
+	Histogram			_hist[Series];
+	Clock::time_point	_frameStart;
+	Clock::time_point	_stageStart;
+	uint64_t			_frameUs[(int)Stage::Count];	//Current frame, render thread only
+
+	static int _bucket(uint64_t us);
+	static double _bucketUpperMs(int bucket);
+	Summary _summarize(const Histogram& hist) const;
+
+public:
+	FrameStats();
+
+	void BeginFrame();
+	void Mark(Stage stage);
+	void EndFrame();
+	void Reset();
+
+	Summary GetStage(Stage stage) const;
+	Summary GetFrame() const;
+	std::string Format() const;
+
+	static const char* StageName(Stage stage);
+};
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "ImageReader.h"
+#include <stdexcept>
+#include "Utils.h"
+
+static uint32_t getLE(const unsigned char* p, int bytes)
+{
+	uint32_t v = 0;
+	for (int i = 0; i < bytes; i++)
+		v |= uint32_t(p[i]) << (8 * i);
+	return v;
+}
+
+static uint8_t grayOf(int r, int g, int b)
+{
+	return (uint8_t)((r * 299 + g * 587 + b * 114) / 1000);
+}
+
+ImageRowReader::ImageRowReader(const std::string& path)
+	: _in(path)
+	, _kind(Kind::Bmp)
+	, _width(0)
+	, _height(0)
+	, _maxval(1)
+	, _bpp(0)
+	, _bottomUp(false)
+	, _rowsRead(0)
+{
+	unsigned char magic[2] = {};
+	_readExact(magic, 2);
+	if (magic[0] == 'P' && magic[1] >= '1' && magic[1] <= '5' && magic[1] != '3')
+		_readPnmHeader((char)magic[1]);
+	else if (magic[0] == 'B' && magic[1] == 'M')
+		_readBmpHeader();
+	else
+		throw std::runtime_error("Unsupported image format, expected PBM, PGM or BMP");
+
+	if (_width <= 0 || _height <= 0 || _width > 0x10000 || _height > 0x10000)
+		throw std::runtime_error("Invalid image size");
+}
+
+void ImageRowReader::_readExact(void* data, size_t size)
+{
+	if (_in.Read(data, size) != size)
+		throw std::runtime_error("Image is truncated");
+}
+
+//Next decimal number of a PNM header or text raster, '#' comments run to the end of the line
+int ImageRowReader::_token()
+{
+	char c;
+	for (;;)
+	{
+		if (!_in.Get(c))
+			throw std::runtime_error("Image is truncated");
+		if (c == '#')
+		{
+			while (c != '\n' && _in.Get(c));
+			continue;
+		}
+		if (c < '0' || c > '9')
+		{
+			if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+				continue;
+			throw std::runtime_error("Invalid character in image");
+		}
+		break;
+	}
+
+	long v = 0;
+	do
+	{
+		v = v * 10 + (c - '0');
+		if (v > 0xFFFFFF)
+			throw std::runtime_error("Invalid number in image");
+	} while (_in.Get(c) && c >= '0' && c <= '9');
+	//The one whitespace after a binary header's last number is consumed here
+	return (int)v;
+}
+
+void ImageRowReader::_readPnmHeader(char type)
+{
+	_kind = type == '1' ? Kind::PbmText : type == '4' ? Kind::PbmBinary : type == '2' ? Kind::PgmText : Kind::PgmBinary;
+	_width = _token();
+	_height = _token();
+	if (_kind == Kind::PgmText || _kind == Kind::PgmBinary)
+	{
+		_maxval = _token();
+		if (_maxval <= 0 || _maxval > 0xFFFF)
+			throw std::runtime_error("Invalid PGM maximum value");
+	}
+}
+
+void ImageRowReader::_readBmpHeader()
+{
+	unsigned char file[12], info[40];
+	_readExact(file, 12);
+	_readExact(info, 40);
+	uint32_t dataOffset = getLE(file + 8, 4);
+	uint32_t infoSize = getLE(info, 4);
+	_width = (int32_t)getLE(info + 4, 4);
+	int32_t height = (int32_t)getLE(info + 8, 4);
+	_bpp = (int)getLE(info + 14, 2);
+	uint32_t compression = getLE(info + 16, 4);
+	uint32_t colors = getLE(info + 32, 4);
+
+	_bottomUp = height > 0;
+	_height = height < 0 ? -height : height;
+	if (_bpp != 1 && _bpp != 4 && _bpp != 8 && _bpp != 24 && _bpp != 32)
+		throw std::runtime_error("Unsupported BMP bit depth");
+	//Bitfields are accepted for 32 bit pictures in the usual BGRA layout
+	if (compression != 0 && !(compression == 3 && _bpp == 32))
+		throw std::runtime_error("Compressed BMPs are not supported");
+	if (infoSize < 40 || dataOffset < 14 + infoSize)
+		throw std::runtime_error("Invalid BMP header");
+
+	std::vector<unsigned char> skip(infoSize - 40);
+	_readExact(skip.data(), skip.size());
+	size_t consumed = 14 + infoSize;
+
+	if (_bpp <= 8)
+	{
+		if (colors == 0 || colors > (1u << _bpp))
+			colors = 1u << _bpp;
+		if (consumed + colors * 4 > dataOffset)
+			throw std::runtime_error("Invalid BMP palette");
+
+		std::vector<unsigned char> palette(colors * 4);
+		_readExact(palette.data(), palette.size());
+		consumed += palette.size();
+		_palette.resize(size_t(1) << _bpp, 0);
+		for (uint32_t i = 0; i < colors; i++)
+			_palette[i] = grayOf(palette[i * 4 + 2], palette[i * 4 + 1], palette[i * 4]);
+	}
+
+	skip.resize(dataOffset - consumed);
+	_readExact(skip.data(), skip.size());
+}
+
+bool ImageRowReader::ReadRow(std::vector<uint8_t>& gray, int& y)
+{
+	if (_rowsRead == _height)
+		return false;
+
+	gray.resize(_width);
+	y = _kind == Kind::Bmp && _bottomUp ? _height - 1 - _rowsRead : _rowsRead;
+	_rowsRead++;
+
+	switch (_kind)
+	{
+	case Kind::PbmText:
+		for (int x = 0; x < _width; x++)
+		{
+			//Digits may be packed without separators
+			char c;
+			do
+			{
+				if (!_in.Get(c))
+					throw std::runtime_error("Image is truncated");
+				if (c == '#')
+					while (c != '\n' && _in.Get(c));
+			} while (c != '0' && c != '1');
+			gray[x] = c == '1' ? 0 : 255;
+		}
+		break;
+
+	case Kind::PgmText:
+		for (int x = 0; x < _width; x++)
+		{
+			int v = _token();
+			gray[x] = (uint8_t)(Min(v, _maxval) * 255 / _maxval);
+		}
+		break;
+
+	case Kind::PbmBinary:
+		_raw.resize((_width + 7) / 8);
+		_readExact(_raw.data(), _raw.size());
+		for (int x = 0; x < _width; x++)
+			gray[x] = (_raw[x / 8] >> (7 - x % 8)) & 1 ? 0 : 255;
+		break;
+
+	case Kind::PgmBinary:
+	{
+		int bytes = _maxval > 255 ? 2 : 1;
+		_raw.resize(size_t(_width) * bytes);
+		_readExact(_raw.data(), _raw.size());
+		for (int x = 0; x < _width; x++)
+		{
+			int v = bytes == 2 ? (_raw[x * 2] << 8) | _raw[x * 2 + 1] : _raw[x];
+			gray[x] = (uint8_t)(Min(v, _maxval) * 255 / _maxval);
+		}
+		break;
+	}
+
+	case Kind::Bmp:
+	{
+		//Rows are padded to 4 bytes
+		_raw.resize(((size_t(_width) * _bpp + 31) / 32) * 4);
+		_readExact(_raw.data(), _raw.size());
+		for (int x = 0; x < _width; x++)
+		{
+			if (_bpp <= 8)
+			{
+				int perByte = 8 / _bpp;
+				int shift = (perByte - 1 - x % perByte) * _bpp;
+				gray[x] = _palette[(_raw[x / perByte] >> shift) & ((1 << _bpp) - 1)];
+			}
+			else
+			{
+				const unsigned char* px = &_raw[size_t(x) * (_bpp / 8)];
+				gray[x] = grayOf(px[2], px[1], px[0]);
+			}
+		}
+		break;
+	}
+	}
+	return true;
+}
+
+int ImageRowReader::GetWidth() const
+{
+	return _width;
+}
+
+int ImageRowReader::GetHeight() const
+{
+	return _height;
+}
+
+uint64_t ImageRowReader::GetConsumed() const
+{
+	return _in.GetConsumed();
+}
+
+uint64_t ImageRowReader::GetSize() const
+{
+	return _in.GetSize();
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "FileReader.h"
+
+//Row by row decoder for the sheet formats artists hand over:
+//PBM (P1, P4), PGM (P2, P5, 8 or 16 bit) and uncompressed BMP (1, 4, 8, 24 and 32 bit).
+//Only one row is expanded at a time, rows come in file order, so bottom-up BMPs arrive last row first.
+//Pixels are gray levels, 0 is black and 255 is white.
+class ImageRowReader
+{
+private:
+	enum class Kind
+	{
+		PbmText,
+		PbmBinary,
+		PgmText,
+		PgmBinary,
+		Bmp
+	};
+
+	FileReader					_in;
+	Kind						_kind;
+	int							_width;
+	int							_height;
+	int							_maxval;
+	int							_bpp;
+	bool						_bottomUp;
+	int							_rowsRead;
+	std::vector<uint8_t>		_palette;	//Gray of each BMP palette entry
+	std::vector<unsigned char>	_raw;
+
+	ImageRowReader(ImageRowReader&) = delete;
+	ImageRowReader& operator=(ImageRowReader&) = delete;
+
+	int _token();
+	void _readPnmHeader(char type);
+	void _readBmpHeader();
+	void _readExact(void* data, size_t size);
+
+public:
+	explicit ImageRowReader(const std::string& path);
+
+	int GetWidth() const;
+	int GetHeight() const;
+	uint64_t GetConsumed() const;
+	uint64_t GetSize() const;
+
+	//Gray levels of the next row, y receives its row in the picture. False after the last row.
+	bool ReadRow(std::vector<uint8_t>& gray, int& y);
+};
\ No newline at end of file
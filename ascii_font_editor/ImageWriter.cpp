@@ -0,0 +1,328 @@
+#include "ImageWriter.h"
+#include <stdexcept>
+#include <cstdio>
+#include <cstdint>
+
+struct Crc32Table
+{
+	uint32_t entries[256];
+
+	Crc32Table()
+	{
+		for (uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++)
+				c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			entries[n] = c;
+		}
+	}
+};
+
+static uint32_t crc32(const unsigned char* data, size_t size, uint32_t crc = 0)
+{
+	static const Crc32Table table;
+
+	crc = ~crc;
+	for (size_t i = 0; i < size; i++)
+		crc = table.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+static void putBE32(std::vector<unsigned char>& out, uint32_t v)
+{
+	out.push_back((v >> 24) & 0xFF);
+	out.push_back((v >> 16) & 0xFF);
+	out.push_back((v >> 8) & 0xFF);
+	out.push_back(v & 0xFF);
+}
+
+static void putChunk(std::vector<unsigned char>& out, const char* type, const std::vector<unsigned char>& data)
+{
+	putBE32(out, (uint32_t)data.size());
+	size_t start = out.size();
+	out.insert(out.end(), type, type + 4);
+	out.insert(out.end(), data.begin(), data.end());
+	putBE32(out, crc32(&out[start], out.size() - start));
+}
+
+//Rows of packed bits, MSB first, set bit means ink
+static std::vector<unsigned char> packRows(const bitmap_t& bmp, bool inkIsZero, bool filterByte)
+{
+	size_t w = bmp.empty() ? 0 : bmp[0].size();
+	size_t stride = (w + 7) / 8;
+	std::vector<unsigned char> out;
+	out.reserve(bmp.size() * (stride + (filterByte ? 1 : 0)));
+
+	for (auto& row : bmp)
+	{
+		if (filterByte)
+			out.push_back(0);
+
+		size_t start = out.size();
+		out.resize(start + stride, inkIsZero ? 0xFF : 0x00);
+		for (size_t x = 0; x < w; x++)
+		{
+			if (row[x] == 0)
+				continue;
+			if (inkIsZero)
+				out[start + x / 8] &= ~(0x80 >> (x % 8));
+			else
+				out[start + x / 8] |= 0x80 >> (x % 8);
+		}
+	}
+
+	return out;
+}
+
+static std::vector<unsigned char> encodePBM(const bitmap_t& bmp, bool whiteInk)
+{
+	size_t w = bmp.empty() ? 0 : bmp[0].size();
+	std::string header = "P4\n" + std::to_string(w) + " " + std::to_string(bmp.size()) + "\n";
+	std::vector<unsigned char> out(header.begin(), header.end());
+	auto bits = packRows(bmp, whiteInk, false);
+	out.insert(out.end(), bits.begin(), bits.end());
+	return out;
+}
+
+static std::vector<unsigned char> encodePNG(const bitmap_t& bmp, bool whiteInk)
+{
+	if (bmp.empty() || bmp[0].empty())
+		throw std::runtime_error("Cannot encode an empty picture as PNG");
+
+	static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	std::vector<unsigned char> out(signature, signature + 8);
+
+	//1-bit grayscale, 0 is black
+	std::vector<unsigned char> ihdr;
+	putBE32(ihdr, (uint32_t)bmp[0].size());
+	putBE32(ihdr, (uint32_t)bmp.size());
+	ihdr.insert(ihdr.end(), { 1, 0, 0, 0, 0 });
+	putChunk(out, "IHDR", ihdr);
+
+	//zlib stream of stored deflate blocks, glyph pictures are small and already bit packed
+	auto raw = packRows(bmp, !whiteInk, true);
+	std::vector<unsigned char> idat = { 0x78, 0x01 };
+	uint32_t a = 1, b = 0;
+	for (auto c : raw)
+	{
+		a = (a + c) % 65521;
+		b = (b + a) % 65521;
+	}
+
+	size_t pos = 0;
+	do
+	{
+		size_t len = Min(raw.size() - pos, (size_t)65535);
+		bool last = pos + len == raw.size();
+		idat.push_back(last ? 1 : 0);
+		idat.push_back(len & 0xFF);
+		idat.push_back((len >> 8) & 0xFF);
+		idat.push_back(~len & 0xFF);
+		idat.push_back((~len >> 8) & 0xFF);
+		idat.insert(idat.end(), raw.begin() + pos, raw.begin() + pos + len);
+		pos += len;
+	} while (pos < raw.size());
+	putBE32(idat, (b << 16) | a);
+
+	putChunk(out, "IDAT", idat);
+	putChunk(out, "IEND", {});
+	return out;
+}
+
+static std::vector<unsigned char> encodePPM(const bitmap_t& bmp, bool whiteInk)
+{
+	size_t w = bmp.empty() ? 0 : bmp[0].size();
+	std::string header = "P6\n" + std::to_string(w) + " " + std::to_string(bmp.size()) + "\n255\n";
+	std::vector<unsigned char> out(header.begin(), header.end());
+	out.reserve(out.size() + bmp.size() * w * 3);
+	for (auto& row : bmp)
+	{
+		for (size_t x = 0; x < w; x++)
+		{
+			unsigned char v = (row[x] != 0) == whiteInk ? 0xFF : 0x00;
+			out.insert(out.end(), 3, v);
+		}
+	}
+	return out;
+}
+
+bool imageFormatFromName(const std::string& name, ImageFormat& format)
+{
+	if (name == "pbm")
+		format = ImageFormat::PBM;
+	else if (name == "png")
+		format = ImageFormat::PNG;
+	else if (name == "ppm")
+		format = ImageFormat::PPM;
+	else if (name == "raw")
+		format = ImageFormat::Raw;
+	else
+		return false;
+	return true;
+}
+
+const char* imageFormatExtension(ImageFormat format)
+{
+	switch (format)
+	{
+	case ImageFormat::PBM:	return ".pbm";
+	case ImageFormat::PNG:	return ".png";
+	case ImageFormat::PPM:	return ".ppm";
+	default:				return ".raw";
+	}
+}
+
+std::vector<unsigned char> encodeImage(const bitmap_t& bmp, ImageFormat format, bool whiteInk)
+{
+	switch (format)
+	{
+	case ImageFormat::PBM:	return encodePBM(bmp, whiteInk);
+	case ImageFormat::PNG:	return encodePNG(bmp, whiteInk);
+	case ImageFormat::PPM:	return encodePPM(bmp, whiteInk);
+	default:				return bmp2raw(bmp);
+	}
+}
+
+void writeImage(const std::string& path, const bitmap_t& bmp, ImageFormat format, bool whiteInk)
+{
+	writeFile(path, encodeImage(bmp, format, whiteInk));
+}
+
+void writeFile(const std::string& path, const std::vector<unsigned char>& data)
+{
+	FILE* f = fopen(path.c_str(), "wb");
+	if (!f)
+		throw std::runtime_error("Failed to open " + path);
+
+	bool failed = !data.empty() && fwrite(data.data(), 1, data.size(), f) != data.size();
+	failed = fclose(f) != 0 || failed;
+	if (failed)
+		throw std::runtime_error("Failed to write " + path);
+}
+
+ImageRowWriter::ImageRowWriter(FileWriter& out, int width, int height, ImageFormat format, const std::vector<uint32_t>& palette)
+	: _out(out)
+	, _format(format)
+	, _width(width)
+	, _height(height)
+	, _rows(0)
+	, _palette(palette)
+	, _adlerA(1)
+	, _adlerB(0)
+	, _zlibHeader(true)
+{
+	if (width <= 0 || height <= 0)
+		throw std::runtime_error("Cannot encode an empty picture");
+	if (palette.empty() || palette.size() > 256)
+		throw std::runtime_error("Palette must have 1 to 256 colors");
+	_palette.resize(256, 0);
+
+	if (format == ImageFormat::PPM)
+	{
+		_out.Write("P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n");
+		_rgb.resize(size_t(width) * 3);
+	}
+	else if (format == ImageFormat::PNG)
+	{
+		static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		_out.Write(signature, 8);
+
+		//8-bit palette picture
+		std::vector<unsigned char> ihdr;
+		putBE32(ihdr, (uint32_t)width);
+		putBE32(ihdr, (uint32_t)height);
+		ihdr.insert(ihdr.end(), { 8, 3, 0, 0, 0 });
+		_chunk("IHDR", ihdr.data(), ihdr.size());
+
+		std::vector<unsigned char> plte;
+		for (size_t i = 0; i < palette.size(); i++)
+		{
+			plte.push_back((palette[i] >> 16) & 0xFF);
+			plte.push_back((palette[i] >> 8) & 0xFF);
+			plte.push_back(palette[i] & 0xFF);
+		}
+		_chunk("PLTE", plte.data(), plte.size());
+		_block.reserve(65535);
+	}
+	else
+		throw std::runtime_error("Row streaming supports PNG and PPM only");
+}
+
+void ImageRowWriter::_chunk(const char* type, const unsigned char* data, size_t size)
+{
+	unsigned char len[4] = { (unsigned char)(size >> 24), (unsigned char)(size >> 16), (unsigned char)(size >> 8), (unsigned char)size };
+	_out.Write(len, 4);
+	_out.Write(type, 4);
+	_out.Write(data, size);
+	uint32_t crc = crc32(data, size, crc32(reinterpret_cast<const unsigned char*>(type), 4));
+	unsigned char tail[4] = { (unsigned char)(crc >> 24), (unsigned char)(crc >> 16), (unsigned char)(crc >> 8), (unsigned char)crc };
+	_out.Write(tail, 4);
+}
+
+//Every stored deflate block goes out as its own IDAT chunk, the zlib header leads the first one
+//and the Adler-32 trailer follows the last one
+void ImageRowWriter::_flushBlock(bool last)
+{
+	size_t len = _block.size();
+	std::vector<unsigned char> idat;
+	idat.reserve(len + 11);
+	if (_zlibHeader)
+		idat.insert(idat.end(), { 0x78, 0x01 });
+	_zlibHeader = false;
+
+	idat.push_back(last ? 1 : 0);
+	idat.push_back(len & 0xFF);
+	idat.push_back((len >> 8) & 0xFF);
+	idat.push_back(~len & 0xFF);
+	idat.push_back((~len >> 8) & 0xFF);
+	idat.insert(idat.end(), _block.begin(), _block.end());
+	if (last)
+		putBE32(idat, (_adlerB << 16) | _adlerA);
+
+	_chunk("IDAT", idat.data(), idat.size());
+	_block.clear();
+}
+
+void ImageRowWriter::WriteRow(const uint8_t* pixels)
+{
+	if (_rows == _height)
+		throw std::runtime_error("Picture has more rows than its height");
+	_rows++;
+
+	if (_format == ImageFormat::PPM)
+	{
+		for (int x = 0; x < _width; x++)
+		{
+			uint32_t c = _palette[pixels[x]];
+			_rgb[x * 3] = (c >> 16) & 0xFF;
+			_rgb[x * 3 + 1] = (c >> 8) & 0xFF;
+			_rgb[x * 3 + 2] = c & 0xFF;
+		}
+		_out.Write(_rgb.data(), _rgb.size());
+		return;
+	}
+
+	//Filter byte 0, then the indices
+	for (int x = -1; x < _width; x++)
+	{
+		unsigned char c = x < 0 ? 0 : pixels[x];
+		_adlerA = (_adlerA + c) % 65521;
+		_adlerB = (_adlerB + _adlerA) % 65521;
+		_block.push_back(c);
+		if (_block.size() == 65535)
+			_flushBlock(false);
+	}
+}
+
+void ImageRowWriter::Finish()
+{
+	if (_rows != _height)
+		throw std::runtime_error("Picture is missing rows");
+
+	if (_format == ImageFormat::PNG)
+	{
+		_flushBlock(true);
+		_chunk("IEND", nullptr, 0);
+	}
+}
\ No newline at end of file
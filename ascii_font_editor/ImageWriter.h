@@ -0,0 +1,54 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Utils.h"
+#include "FileWriter.h"
+
+//Encoders for 1-bit pictures, any non-zero pixel is ink.
+//PBM, PNG and PPM store ink as black on white, or white on black for textures that read the gray value as coverage.
+//Raw is one byte per pixel (0/1), row by row, no header.
+enum class ImageFormat
+{
+	PBM,
+	PNG,
+	PPM,
+	Raw
+};
+
+bool imageFormatFromName(const std::string& name, ImageFormat& format);
+const char* imageFormatExtension(ImageFormat format);
+std::vector<unsigned char> encodeImage(const bitmap_t& bmp, ImageFormat format, bool whiteInk = false);
+void writeImage(const std::string& path, const bitmap_t& bmp, ImageFormat format, bool whiteInk = false);
+void writeFile(const std::string& path, const std::vector<unsigned char>& data);
+
+//Streams a palette picture to PNG or PPM one row at a time, memory use depends on the width only.
+//Pixels are palette indices, colors are 0xRRGGBB. PNG keeps the palette, PPM expands it to RGB.
+//Finish must see exactly height rows.
+class ImageRowWriter
+{
+private:
+	FileWriter&					_out;
+	ImageFormat					_format;
+	int							_width;
+	int							_height;
+	int							_rows;
+	std::vector<uint32_t>		_palette;
+	std::vector<unsigned char>	_block;		//PNG: pending bytes of the current stored deflate block
+	std::vector<unsigned char>	_rgb;		//PPM: one expanded row
+	uint32_t					_adlerA;
+	uint32_t					_adlerB;
+	bool						_zlibHeader;
+
+	ImageRowWriter(ImageRowWriter&) = delete;
+	ImageRowWriter& operator=(ImageRowWriter&) = delete;
+
+	void _chunk(const char* type, const unsigned char* data, size_t size);
+	void _flushBlock(bool last);
+
+public:
+	ImageRowWriter(FileWriter& out, int width, int height, ImageFormat format, const std::vector<uint32_t>& palette);
+
+	void WriteRow(const uint8_t* pixels);
+	void Finish();
+};
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "InputQueue.h"
+
+void InputQueue::Push(const InputEvent& ev)
+{
+	{
+		std::lock_guard<std::mutex> guard(_lock);
+		_events.push_back(ev);
+	}
+	_signal.notify_one();
+}
+
+void InputQueue::Wake()
+{
+	Push({ InputEvent::Type::Wake, 0, 0, 0 });
+}
+
+void InputQueue::Wait(InputEvent& ev)
+{
+	std::unique_lock<std::mutex> guard(_lock);
+	_signal.wait(guard, [this]() { return !_events.empty(); });
+	ev = _events.front();
+	_events.pop_front();
+}
+
+bool InputQueue::Poll(InputEvent& ev)
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	if (_events.empty())
+		return false;
+
+	ev = _events.front();
+	_events.pop_front();
+	return true;
+}
+
+void InputQueue::Clear()
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	_events.clear();
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+struct InputEvent
+{
+	enum class Type
+	{
+		Key,
+		Wake	//Window state changed (closed, reinit requested), carries no key
+	};
+
+	Type	type;
+	int		key;	//GLFW key code
+	int		action;	//GLFW_PRESS, GLFW_REPEAT or GLFW_RELEASE
+	int		mods;	//GLFW_MOD_* bits
+};
+
+//Multi producer queue of input events for a thread that sleeps until there is something to do.
+//Window callbacks push from the render thread, the application thread blocks in Wait.
+//Events are delivered in the order they were pushed, nothing is dropped or merged.
+class InputQueue
+{
+private:
+	std::mutex					_lock;
+	std::condition_variable		_signal;
+	std::deque<InputEvent>		_events;
+
+	InputQueue(InputQueue&) = delete;
+	InputQueue& operator=(InputQueue&) = delete;
+
+public:
+	InputQueue() {}
+
+	void Push(const InputEvent& ev);
+	void Wake();
+	void Wait(InputEvent& ev);
+	bool Poll(InputEvent& ev);
+	void Clear();
+};
\ No newline at end of file
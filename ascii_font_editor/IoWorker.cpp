@@ -0,0 +1,143 @@
+#include "IoWorker.h"
+
+IoTask::IoTask()
+	: _permille(-1)
+	, _cancel(false)
+{
+}
+
+void IoTask::Report(uint64_t done, uint64_t total)
+{
+	Check();
+
+	int permille = total ? int(done >= total ? 1000 : done * 1000 / total) : 0;
+	if (_permille.exchange(permille, std::memory_order_relaxed) != permille && _observer)
+		_observer(permille / 1000.0);
+}
+
+void IoTask::Check() const
+{
+	if (_cancel.load(std::memory_order_relaxed))
+		throw IoCancelled();
+}
+
+bool IoTask::IsCancelled() const
+{
+	return _cancel.load(std::memory_order_relaxed);
+}
+
+double IoTask::GetProgress() const
+{
+	int permille = _permille.load(std::memory_order_relaxed);
+	return permille < 0 ? -1.0 : permille / 1000.0;
+}
+
+IoWorker::IoWorker(Observer observer)
+	: _busy(false)
+	, _stop(false)
+{
+	_task._observer = observer;
+	_thread = std::thread(&IoWorker::_run, this);
+}
+
+IoWorker::~IoWorker()
+{
+	{
+		std::lock_guard<std::mutex> guard(_lock);
+		_stop = true;
+		_task._cancel = true;
+	}
+	_signal.notify_one();
+	_thread.join();
+}
+
+void IoWorker::_run()
+{
+	for (;;)
+	{
+		std::unique_ptr<Pending> pending;
+		{
+			std::unique_lock<std::mutex> guard(_lock);
+			_signal.wait(guard, [this]() { return _stop || _pending; });
+			if (_stop)
+				return;
+			pending = std::move(_pending);
+		}
+
+		Result result = Result::Done;
+		std::string error;
+		try
+		{
+			pending->job(_task);
+		}
+		catch (const IoCancelled&)
+		{
+			result = Result::Cancelled;
+		}
+		catch (const std::exception& ex)
+		{
+			result = Result::Failed;
+			error = ex.what();
+		}
+
+		_task._permille = -1;
+		if (_task._observer)
+			_task._observer(-1.0);
+
+		if (pending->finish)
+		{
+			try
+			{
+				pending->finish(result, error);
+			}
+			catch (...)
+			{
+			}
+		}
+
+		std::lock_guard<std::mutex> guard(_lock);
+		_busy = false;
+		_name.clear();
+	}
+}
+
+bool IoWorker::Submit(const std::string& name, Job job, Finish finish)
+{
+	{
+		std::lock_guard<std::mutex> guard(_lock);
+		if (_busy || _stop)
+			return false;
+
+		_busy = true;
+		_name = name;
+		_task._cancel = false;
+		_task._permille = -1;
+		_pending.reset(new Pending({ name, std::move(job), std::move(finish) }));
+	}
+	_signal.notify_one();
+	return true;
+}
+
+void IoWorker::Cancel()
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	if (_busy)
+		_task._cancel = true;
+}
+
+bool IoWorker::IsBusy() const
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	return _busy;
+}
+
+std::string IoWorker::GetName() const
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	return _name;
+}
+
+double IoWorker::GetProgress() const
+{
+	return _task.GetProgress();
+}
\ No newline at end of file
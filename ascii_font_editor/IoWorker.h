@@ -0,0 +1,88 @@
+#pragma once
+#include <string>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <stdexcept>
+#include <cstdint>
+
+//Thrown out of a job by IoTask once the job was cancelled
+class IoCancelled : public std::runtime_error
+{
+public:
+	IoCancelled() : std::runtime_error("Operation cancelled") {}
+};
+
+//Progress and cancellation of the job that is running on an IoWorker
+class IoTask
+{
+private:
+	std::atomic<int>				_permille;
+	std::atomic<bool>				_cancel;
+	std::function<void(double)>		_observer;
+
+	friend class IoWorker;
+
+public:
+	IoTask();
+
+	//Progress of the current stage, throws IoCancelled once the job is cancelled
+	void Report(uint64_t done, uint64_t total);
+	void Check() const;
+	bool IsCancelled() const;
+	double GetProgress() const;	//-1 before the first report
+};
+
+//Runs file jobs one at a time on its own thread, so windows keep rendering while fonts load and save.
+//The observer gets progress from 0 to 1 whenever it moves by a tenth of a percent, -1 when a job ends.
+//Finish callbacks run on the worker thread.
+class IoWorker
+{
+public:
+	enum class Result
+	{
+		Done,
+		Cancelled,
+		Failed
+	};
+
+	using Job = std::function<void(IoTask&)>;
+	using Finish = std::function<void(Result, const std::string&)>;
+	using Observer = std::function<void(double)>;
+
+private:
+	struct Pending
+	{
+		std::string		name;
+		Job				job;
+		Finish			finish;
+	};
+
+	mutable std::mutex			_lock;
+	std::condition_variable		_signal;
+	std::unique_ptr<Pending>	_pending;
+	std::string					_name;
+	bool						_busy;
+	bool						_stop;
+	IoTask						_task;
+	std::thread					_thread;
+
+	IoWorker(IoWorker&) = delete;
+	IoWorker& operator=(IoWorker&) = delete;
+
+	void _run();
+
+public:
+	explicit IoWorker(Observer observer = nullptr);
+	~IoWorker();
+
+	//Returns false while another job is queued or running
+	bool Submit(const std::string& name, Job job, Finish finish = nullptr);
+	void Cancel();
+	bool IsBusy() const;
+	std::string GetName() const;
+	double GetProgress() const;
+};
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include "OffscreenWindow.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cstdio>
+
+OffscreenWindow::OffscreenWindow(int width, int height, const char* /*title*/)
+	: _width(width)
+	, _height(height)
+	, _background(0)
+	, _active(true)
+	, _frames(0)
+{
+	if (width <= 0 || height <= 0)
+		throw std::runtime_error("Invalid offscreen window size");
+	_buffer.resize(size_t(width) * height, _background);
+}
+
+OffscreenWindow::~OffscreenWindow()
+{
+}
+
+void OffscreenWindow::setBackgroundColor(int color)
+{
+	if ((uint32_t)color == _background)
+		return;
+
+	_background = (uint32_t)color;
+	std::fill(_buffer.begin(), _buffer.end(), _background);
+}
+
+void OffscreenWindow::setPixel(int x, int y, int color)
+{
+	if (x < 0 || y < 0 || x >= _width || y >= _height)
+		return;
+
+	_buffer[size_t(y) * _width + x] = (uint32_t)color;
+}
+
+void OffscreenWindow::beginFrame()
+{
+	std::fill(_buffer.begin(), _buffer.end(), _background);
+}
+
+void OffscreenWindow::endFrame()
+{
+	if (!_dumpPattern.empty())
+	{
+		char path[1024];
+		snprintf(path, sizeof(path), _dumpPattern.c_str(), _frames);
+		dumpPPM(path);
+	}
+	_frames++;
+}
+
+int OffscreenWindow::getWidth() const noexcept
+{
+	return _width;
+}
+
+int OffscreenWindow::getHeight() const noexcept
+{
+	return _height;
+}
+
+bool OffscreenWindow::isActive() const noexcept
+{
+	return _active;
+}
+
+void OffscreenWindow::pollEvents() const noexcept
+{
+}
+
+void OffscreenWindow::makeCurrent() const noexcept
+{
+}
+
+void OffscreenWindow::forceClose() noexcept
+{
+	_active = false;
+}
+
+uint32_t OffscreenWindow::getPixel(int x, int y) const
+{
+	if (x < 0 || y < 0 || x >= _width || y >= _height)
+		return 0;
+
+	return _buffer[size_t(y) * _width + x];
+}
+
+const std::vector<uint32_t>& OffscreenWindow::getFramebuffer() const
+{
+	return _buffer;
+}
+
+size_t OffscreenWindow::getFrameCount() const
+{
+	return _frames;
+}
+
+void OffscreenWindow::setDumpPattern(const std::string& pattern)
+{
+	_dumpPattern = pattern;
+}
+
+void OffscreenWindow::dumpPPM(const std::string& path) const
+{
+	FILE* f = fopen(path.c_str(), "wb");
+	if (!f)
+		throw std::runtime_error("Failed to open " + path);
+
+	fprintf(f, "P6\n%d %d\n255\n", _width, _height);
+	std::vector<unsigned char> row(size_t(_width) * 3);
+	for (int y = 0; y < _height; y++)
+	{
+		const uint32_t* src = &_buffer[size_t(y) * _width];
+		for (int x = 0; x < _width; x++)
+		{
+			row[x * 3 + 0] = (src[x] >> 16) & 0xFF;
+			row[x * 3 + 1] = (src[x] >> 8) & 0xFF;
+			row[x * 3 + 2] = src[x] & 0xFF;
+		}
+		fwrite(row.data(), 1, row.size(), f);
+	}
+
+	bool failed = ferror(f) != 0;
+	fclose(f);
+	if (failed)
+		throw std::runtime_error("Failed to write " + path);
+}
\ No newline at end of file
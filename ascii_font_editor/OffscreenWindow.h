@@ -0,0 +1,46 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+
+//Memory framebuffer with the drawing surface of pw::PixelWindow
+//(setPixel/beginFrame/endFrame/setBackgroundColor), for render loops on hosts without a GPU.
+//Colors are 0xAARRGGBB like the ones passed to pw::PixelWindow.
+class OffscreenWindow
+{
+private:
+	int						_width;
+	int						_height;
+	std::vector<uint32_t>	_buffer;
+	uint32_t				_background;
+	bool					_active;
+	size_t					_frames;
+	std::string				_dumpPattern;
+
+	OffscreenWindow(OffscreenWindow&) = delete;
+	OffscreenWindow& operator=(OffscreenWindow&) = delete;
+
+public:
+	OffscreenWindow(int width, int height, const char* title = "");
+	~OffscreenWindow();
+
+	void setBackgroundColor(int color);
+	void setPixel(int x, int y, int color);
+	void beginFrame();
+	void endFrame();
+
+	int getWidth() const noexcept;
+	int getHeight() const noexcept;
+	bool isActive() const noexcept;
+	void pollEvents() const noexcept;
+	void makeCurrent() const noexcept;
+	void forceClose() noexcept;
+
+	uint32_t getPixel(int x, int y) const;
+	const std::vector<uint32_t>& getFramebuffer() const;
+	size_t getFrameCount() const;
+
+	//printf style pattern with one %zu for the frame number, e.g. "frame_%05zu.ppm". Empty disables dumping.
+	void setDumpPattern(const std::string& pattern);
+	void dumpPPM(const std::string& path) const;
+};
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <exception>
+#include <algorithm>
+
+//Runs fn(i) for every i in [0, count) on up to `threads` workers (0 = one per core).
+//Items are handed out one at a time, so uneven jobs balance themselves.
+//The first exception thrown by fn stops the remaining items and is rethrown here.
+template<class Fn>
+void parallelFor(size_t count, unsigned threads, Fn fn)
+{
+	if (threads == 0)
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	threads = (unsigned)std::min<size_t>(threads, count);
+
+	std::atomic<size_t> next(0);
+	std::atomic<bool> failed(false);
+	std::exception_ptr error;
+	std::mutex errorLock;
+
+	auto worker = [&]()
+	{
+		for (size_t i = next++; i < count && !failed; i = next++)
+		{
+			try
+			{
+				fn(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> guard(errorLock);
+				if (!error)
+					error = std::current_exception();
+				failed = true;
+			}
+		}
+	};
+
+	if (threads <= 1)
+		worker();
+	else
+	{
+		std::vector<std::thread> pool;
+		for (unsigned t = 0; t < threads; t++)
+			pool.emplace_back(worker);
+		for (auto& t : pool)
+			t.join();
+	}
+
+	if (error)
+		std::rethrow_exception(error);
+}
\ No newline at end of file
@@ -0,0 +1,365 @@
+#include "PsfFont.h"
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+
+static const unsigned char s_psf1Magic[2] = { 0x36, 0x04 };
+static const unsigned char s_psf2Magic[4] = { 0x72, 0xB5, 0x4A, 0x86 };
+static const size_t s_psf2Header = 32;
+
+enum Psf1Mode
+{
+	PSF1_MODE512 = 0x01,
+	PSF1_MODEHASTAB = 0x02,
+	PSF1_MODEHASSEQ = 0x04
+};
+
+static const uint32_t PSF2_HAS_UNICODE_TABLE = 0x01;
+static const uint32_t PSF1_SEPARATOR = 0xFFFF, PSF1_STARTSEQ = 0xFFFE;
+static const unsigned char PSF2_SEPARATOR = 0xFF, PSF2_STARTSEQ = 0xFE;
+
+static uint32_t getLE32(const unsigned char* p)
+{
+	return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+static void putLE(std::vector<unsigned char>& out, uint32_t v, int bytes)
+{
+	for (int i = 0; i < bytes; i++)
+		out.push_back((v >> (8 * i)) & 0xFF);
+}
+
+static uint32_t directCode(size_t glyph)
+{
+	return glyph < 0x900 ? 0xF000 + (uint32_t)glyph : 0xF0000 + (uint32_t)glyph;
+}
+
+int psfVersion(const std::vector<unsigned char>& data)
+{
+	if (data.size() >= 4 && memcmp(data.data(), s_psf2Magic, 4) == 0)
+		return 2;
+	if (data.size() >= 2 && memcmp(data.data(), s_psf1Magic, 2) == 0)
+		return 1;
+	return 0;
+}
+
+struct PsfLayout
+{
+	int				width;
+	int				height;
+	size_t			count;
+	size_t			glyphBytes;
+	const unsigned char*	glyphs;
+	const unsigned char*	table;	//Null without a Unicode table
+	const unsigned char*	end;
+};
+
+static PsfLayout readHeader(const std::vector<unsigned char>& data, int version)
+{
+	PsfLayout psf = {};
+	psf.end = data.data() + data.size();
+	size_t headerSize;
+	bool hasTable;
+	if (version == 1)
+	{
+		if (data.size() < 4)
+			throw std::runtime_error("PSF1 header is truncated");
+		unsigned char mode = data[2];
+		psf.width = 8;
+		psf.height = data[3];
+		psf.count = mode & PSF1_MODE512 ? 512 : 256;
+		psf.glyphBytes = psf.height;
+		headerSize = 4;
+		hasTable = (mode & (PSF1_MODEHASTAB | PSF1_MODEHASSEQ)) != 0;
+	}
+	else
+	{
+		if (data.size() < s_psf2Header)
+			throw std::runtime_error("PSF2 header is truncated");
+		const unsigned char* p = data.data();
+		headerSize = getLE32(p + 8);
+		uint32_t flags = getLE32(p + 12);
+		psf.count = getLE32(p + 16);
+		psf.glyphBytes = getLE32(p + 20);
+		psf.height = (int)getLE32(p + 24);
+		psf.width = (int)getLE32(p + 28);
+		hasTable = (flags & PSF2_HAS_UNICODE_TABLE) != 0;
+
+		if (getLE32(p + 4) != 0)
+			throw std::runtime_error("Unsupported PSF2 version");
+		if (psf.width <= 0 || psf.width > 0xFFFF || psf.height > 0xFFFF || headerSize < s_psf2Header ||
+			psf.glyphBytes != size_t(psf.height) * ((psf.width + 7) / 8))
+			throw std::runtime_error("Invalid PSF2 header");
+	}
+
+	if (psf.height <= 0 || psf.count == 0)
+		throw std::runtime_error("Invalid font resolution");
+	if (headerSize > data.size() || psf.count > (data.size() - headerSize) / psf.glyphBytes)
+		throw std::runtime_error("PSF glyph data is truncated");
+
+	psf.glyphs = data.data() + headerSize;
+	if (hasTable)
+		psf.table = psf.glyphs + psf.count * psf.glyphBytes;
+	return psf;
+}
+
+//Single code points of every glyph, sequences of combining characters have no place in a Font
+static std::vector<std::vector<utf8char_t>> readTable(const PsfLayout& psf, int version)
+{
+	std::vector<std::vector<utf8char_t>> codes(psf.count);
+	const unsigned char* p = psf.table;
+	for (size_t g = 0; g < psf.count && p < psf.end; g++)
+	{
+		bool sequence = false;
+		if (version == 1)
+		{
+			for (; p + 2 <= psf.end; p += 2)
+			{
+				uint32_t v = uint32_t(p[0]) | (uint32_t(p[1]) << 8);
+				if (v == PSF1_SEPARATOR)
+				{
+					p += 2;
+					break;
+				}
+				if (v == PSF1_STARTSEQ)
+					sequence = true;
+				else if (!sequence)
+					codes[g].push_back(codepoint_to_utf8char(v));
+			}
+			continue;
+		}
+
+		while (p < psf.end)
+		{
+			unsigned char c = *p;
+			if (c == PSF2_SEPARATOR)
+			{
+				p++;
+				break;
+			}
+			if (c == PSF2_STARTSEQ)
+			{
+				sequence = true;
+				p++;
+				continue;
+			}
+
+			int len = (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 1;
+			if (p + len > psf.end)
+				throw std::runtime_error("PSF2 Unicode table is truncated");
+
+			//The table is UTF-8 already, the bytes are the packed character
+			utf8char_t ch = 0;
+			for (int i = 0; i < len; i++)
+				ch |= utf8char_t(p[i]) << (8 * i);
+			if (!sequence)
+				codes[g].push_back(ch);
+			p += len;
+		}
+	}
+	return codes;
+}
+
+Font decodePsf(const std::vector<unsigned char>& data)
+{
+	int version = psfVersion(data);
+	if (version == 0)
+		throw std::runtime_error("Not a PSF font");
+
+	PsfLayout psf = readHeader(data, version);
+	int w = psf.width, h = psf.height;
+	size_t glyphBits = size_t(w) * h;
+	size_t stride = (w + 7) / 8;
+
+	std::vector<utf8char_t> seq;
+	std::vector<std::pair<size_t, utf8char_t>> aliases;
+	if (psf.table)
+	{
+		auto codes = readTable(psf, version);
+
+		//First code of a glyph keeps its position, a code claimed by an earlier glyph is dropped
+		std::unordered_set<utf8char_t> used;
+		std::vector<bool> mapped(psf.count, false);
+		seq.resize(psf.count, 0);
+		for (size_t g = 0; g < psf.count; g++)
+		{
+			for (auto ch : codes[g])
+			{
+				if (!used.insert(ch).second)
+					continue;
+				if (mapped[g])
+					aliases.push_back({ g, ch });
+				else
+					seq[g] = ch;
+				mapped[g] = true;
+			}
+		}
+		for (size_t g = 0; g < psf.count; g++)
+		{
+			if (!mapped[g])
+				seq[g] = codepoint_to_utf8char(directCode(g));
+		}
+	}
+
+	//Rows go straight from the file into the glyph dictionary
+	std::vector<unsigned char> bits((psf.count + aliases.size()) * glyphBits);
+	for (size_t g = 0; g < psf.count; g++)
+	{
+		const unsigned char* src = psf.glyphs + g * psf.glyphBytes;
+		unsigned char* dst = &bits[g * glyphBits];
+		for (int y = 0; y < h; y++, src += stride)
+		{
+			for (int x = 0; x < w; x++)
+				*dst++ = (src[x >> 3] >> (7 - (x & 7))) & 1;
+		}
+	}
+
+	for (size_t i = 0; i < aliases.size(); i++)
+	{
+		memcpy(&bits[(psf.count + i) * glyphBits], &bits[aliases[i].first * glyphBits], glyphBits);
+		seq.push_back(aliases[i].second);
+	}
+
+	return Font::makeFromBits(std::move(bits), h, w, 0, std::move(seq), psf.table != nullptr);
+}
+
+static std::string packGlyph(const unsigned char* src, int w, int h)
+{
+	size_t stride = (w + 7) / 8;
+	std::string rows(h * stride, '\0');
+	for (int y = 0; y < h; y++)
+	{
+		for (int x = 0; x < w; x++)
+		{
+			if (*src++ != 0)
+				rows[y * stride + x / 8] |= char(0x80 >> (x % 8));
+		}
+	}
+	return rows;
+}
+
+std::vector<unsigned char> encodePsf(const Font& font, int version)
+{
+	if (version != 1 && version != 2)
+		throw std::runtime_error("Unknown PSF version");
+
+	int w = font.GetWidth(), h = font.GetHeight();
+	size_t glyphBits = size_t(w) * h;
+	auto& bits = font.GetBits();
+	auto& seq = font.GetSequence();
+	size_t count = bits.size() / glyphBits;
+	bool unicode = font.IsUTF8() && !seq.empty();
+
+	std::vector<std::string> glyphs;
+	std::vector<std::vector<uint32_t>> codes;
+	if (unicode)
+	{
+		//Copies made on import for extra code points sit after the PSF glyphs, each matches an earlier glyph
+		//and has a code from the table. Only that trailing run folds back, every other glyph keeps its
+		//position even when it looks like another one. Blank glyphs are never folded.
+		std::vector<std::string> packed(count);
+		std::vector<size_t> first(count);
+		std::unordered_map<std::string, size_t> index;
+		for (size_t g = 0; g < count; g++)
+		{
+			packed[g] = packGlyph(&bits[g * glyphBits], w, h);
+			first[g] = index.emplace(packed[g], g).first->second;
+		}
+
+		size_t psfCount = count, lastFirst = 0;
+		while (psfCount > 0)
+		{
+			size_t g = psfCount - 1;
+			bool blank = packed[g].find_first_not_of('\0') == std::string::npos;
+			if (blank || Max(lastFirst, first[g]) >= g || utf8char_to_codepoint(seq[g]) == directCode(g))
+				break;
+			lastFirst = Max(lastFirst, first[g]);
+			psfCount--;
+		}
+
+		glyphs.assign(std::make_move_iterator(packed.begin()), std::make_move_iterator(packed.begin() + psfCount));
+		codes.resize(psfCount);
+		for (size_t g = 0; g < count; g++)
+		{
+			size_t pos = g < psfCount ? g : first[g];
+			uint32_t cp = utf8char_to_codepoint(seq[g]);
+			if (cp <= 0x10FFFF && (cp < 0xD800 || cp > 0xDFFF) && cp != directCode(pos))
+				codes[pos].push_back(cp);
+		}
+	}
+	else if (!seq.empty())
+	{
+		//8-bit codes are glyph positions, the first glyph of a code wins as in Font
+		glyphs.assign(256, std::string(h * ((w + 7) / 8), '\0'));
+		std::vector<bool> placed(256, false);
+		for (size_t g = 0; g < count; g++)
+		{
+			if (seq[g] < 256 && !placed[seq[g]])
+			{
+				glyphs[seq[g]] = packGlyph(&bits[g * glyphBits], w, h);
+				placed[seq[g]] = true;
+			}
+		}
+	}
+	else
+	{
+		for (size_t g = 0; g < count; g++)
+			glyphs.push_back(packGlyph(&bits[g * glyphBits], w, h));
+	}
+
+	std::vector<unsigned char> out;
+	if (version == 1)
+	{
+		if (w != 8)
+			throw std::runtime_error("PSF1 glyphs are 8 pixels wide");
+		if (h > 255 || glyphs.size() > 512)
+			throw std::runtime_error("Font is too big for PSF1");
+
+		glyphs.resize(glyphs.size() > 256 ? 512 : 256, std::string(h, '\0'));
+		codes.resize(unicode ? glyphs.size() : 0);
+		out.insert(out.end(), s_psf1Magic, s_psf1Magic + 2);
+		out.push_back((glyphs.size() == 512 ? PSF1_MODE512 : 0) | (unicode ? PSF1_MODEHASTAB : 0));
+		out.push_back((unsigned char)h);
+	}
+	else
+	{
+		out.insert(out.end(), s_psf2Magic, s_psf2Magic + 4);
+		putLE(out, 0, 4);
+		putLE(out, (uint32_t)s_psf2Header, 4);
+		putLE(out, unicode ? PSF2_HAS_UNICODE_TABLE : 0, 4);
+		putLE(out, (uint32_t)glyphs.size(), 4);
+		putLE(out, (uint32_t)(h * ((w + 7) / 8)), 4);
+		putLE(out, (uint32_t)h, 4);
+		putLE(out, (uint32_t)w, 4);
+	}
+
+	for (auto& glyph : glyphs)
+		out.insert(out.end(), glyph.begin(), glyph.end());
+
+	for (auto& list : codes)
+	{
+		for (auto cp : list)
+		{
+			if (version == 1)
+			{
+				//UCS-2 has no room for the rest
+				if (cp < PSF1_STARTSEQ)
+					putLE(out, cp, 2);
+			}
+			else
+			{
+				std::string u8 = utf8char_to_stdString(codepoint_to_utf8char(cp));
+				out.insert(out.end(), u8.begin(), u8.end());
+			}
+		}
+		if (version == 1)
+			putLE(out, PSF1_SEPARATOR, 2);
+		else
+			out.push_back(PSF2_SEPARATOR);
+	}
+	return out;
+}
\ No newline at end of file
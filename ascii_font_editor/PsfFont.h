@@ -0,0 +1,17 @@
+#pragma once
+#include <vector>
+#include "Font.h"
+
+//Linux console fonts.
+//PSF1 glyphs are 8 pixels wide, 256 or 512 of them, the Unicode table holds UCS-2 codes.
+//PSF2 glyphs have any size, the Unicode table holds UTF-8. Rows are padded to whole bytes, MSB first.
+//A PSF glyph can stand for several code points while a Font glyph has one code,
+//the extra code points become copies of the glyph after the PSF ones. On export a trailing run of
+//glyphs that copy earlier ones folds back, all other glyphs keep their count and positions.
+//Glyphs without a code get the kernel's direct mapping, U+F000 plus the glyph position.
+//Fonts without a Unicode table load as 8-bit fonts addressed by glyph position.
+
+//0 when the data is not a PSF font
+int psfVersion(const std::vector<unsigned char>& data);
+Font decodePsf(const std::vector<unsigned char>& data);
+std::vector<unsigned char> encodePsf(const Font& font, int version);
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "SheetImporter.h"
+#include "ImageReader.h"
+#include "CellGeometry.h"
+#include <stdexcept>
+
+Font importSheet(const std::string& path, const SheetOptions& options, const ProgressFn& progress)
+{
+	if (options.cellW <= 0 || options.cellH <= 0)
+		throw std::runtime_error("Invalid cell size");
+	if (options.interval < 0 || options.interval > options.cellW)
+		throw std::runtime_error("Invalid interval value");
+
+	ImageRowReader image(path);
+	int width = image.GetWidth(), height = image.GetHeight();
+	int columns = (width + 1) / (options.cellW + 1), rows = (height + 1) / (options.cellH + 1);
+	if (columns == 0 || rows == 0)
+		throw std::runtime_error("Image is smaller than one cell");
+
+	size_t cells = size_t(columns) * rows;
+	bool utf8 = false;
+	std::vector<utf8char_t> seq = Font::parseSequence(options.sequence, cells, utf8);
+	if (seq.empty())
+		throw std::runtime_error("Font alphabet sequence is empty");
+	if (seq.size() > cells)
+		throw std::runtime_error("Sheet has " + std::to_string(cells) + " cells, sequence needs " + std::to_string(seq.size()));
+	size_t count = seq.size();
+
+	CellGeometry geometry(options.cellH, options.cellW, (int)count, width);
+	int glyphSize = options.cellW * options.cellH;
+	std::vector<unsigned char> bits(count * glyphSize, 0);
+	std::vector<uint8_t> gray;
+	int y;
+	while (image.ReadRow(gray, y))
+	{
+		CellGeometry::Cell cell;
+		//Locate rejects grid rows and rows of the table past the last glyph
+		if (geometry.Locate(0, y, cell))
+		{
+			size_t first = cell.index;
+			size_t last = Min(first + columns, count);
+			for (size_t i = first; i < last; i++)
+			{
+				const uint8_t* src = &gray[geometry.OriginX((int)i)];
+				unsigned char* dst = &bits[i * glyphSize + cell.y * options.cellW];
+				for (int x = 0; x < options.cellW; x++)
+					dst[x] = (src[x] < options.threshold) != options.invert;
+			}
+		}
+
+		if (progress && ((y & 0xFF) == 0xFF))
+			progress(image.GetConsumed(), image.GetSize());
+	}
+	if (progress)
+		progress(image.GetSize(), image.GetSize());
+
+	return Font::makeFromBits(std::move(bits), options.cellH, options.cellW, options.interval, std::move(seq), utf8);
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+#include "Font.h"
+#include "FontIO.h"
+
+struct SheetOptions
+{
+	int			cellW = 0;
+	int			cellH = 0;
+	std::string	sequence;			//Codes in font file notation ("32-127, 0x41"), empty takes every cell as 0..n-1
+	int			threshold = 128;	//Gray levels below it are ink
+	bool		invert = false;		//Light ink on a dark sheet
+	int			interval = 0;
+};
+
+//Slices a PBM, PGM or BMP sprite sheet laid out like the editor's font table:
+//cells are cellW x cellH, separated by 1px grid lines with no outer border, filled row by row.
+//The picture is streamed one row at a time straight into the glyph bits.
+Font importSheet(const std::string& path, const SheetOptions& options, const ProgressFn& progress = nullptr);
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "SkylinePacker.h"
+#include <climits>
+
+SkylinePacker::SkylinePacker(int w, int h)
+{
+	Reset(w, h);
+}
+
+void SkylinePacker::Reset(int w, int h)
+{
+	_width = w;
+	_height = h;
+	_skyline.clear();
+	_skyline.push_back({ 0, 0, w });
+}
+
+//Lowest y a rectangle can rest at with its left edge on the segment
+bool SkylinePacker::_fit(size_t index, int w, int h, int& y) const
+{
+	int x = _skyline[index].x;
+	if (x + w > _width)
+		return false;
+
+	y = 0;
+	int left = w;
+	for (size_t i = index; left > 0; i++)
+	{
+		if (i == _skyline.size())
+			return false;
+		if (_skyline[i].y > y)
+			y = _skyline[i].y;
+		if (y + h > _height)
+			return false;
+		left -= _skyline[i].width;
+	}
+	return true;
+}
+
+bool SkylinePacker::Insert(int w, int h, int& x, int& y)
+{
+	if (w <= 0 || h <= 0)
+	{
+		x = y = 0;
+		return true;
+	}
+
+	size_t best = _skyline.size();
+	int bestY = INT_MAX, bestWidth = INT_MAX;
+	for (size_t i = 0; i < _skyline.size(); i++)
+	{
+		int top;
+		if (!_fit(i, w, h, top))
+			continue;
+
+		if (top + h < bestY || (top + h == bestY && _skyline[i].width < bestWidth))
+		{
+			best = i;
+			bestY = top + h;
+			bestWidth = _skyline[i].width;
+		}
+	}
+	if (best == _skyline.size())
+		return false;
+
+	x = _skyline[best].x;
+	y = bestY - h;
+
+	//The new segment covers the rectangle top, segments under it shrink or go away
+	_skyline.insert(_skyline.begin() + best, { x, bestY, w });
+	int right = x + w;
+	size_t i = best + 1;
+	while (i < _skyline.size() && _skyline[i].x < right)
+	{
+		int end = _skyline[i].x + _skyline[i].width;
+		if (end <= right)
+		{
+			_skyline.erase(_skyline.begin() + i);
+			continue;
+		}
+		_skyline[i].width = end - right;
+		_skyline[i].x = right;
+		break;
+	}
+
+	//Neighbours at the same height are one segment
+	for (size_t n = best > 0 ? best - 1 : 0; n + 1 < _skyline.size() && n <= best + 1;)
+	{
+		if (_skyline[n].y == _skyline[n + 1].y)
+		{
+			_skyline[n].width += _skyline[n + 1].width;
+			_skyline.erase(_skyline.begin() + n + 1);
+		}
+		else
+			n++;
+	}
+	return true;
+}
+
+int SkylinePacker::GetWidth() const
+{
+	return _width;
+}
+
+int SkylinePacker::GetHeight() const
+{
+	return _height;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+//Bottom-left skyline rectangle packer.
+//The packed area is kept as a list of horizontal segments, each rectangle goes where its top
+//ends up lowest, ties go to the spot that leaves the least width unused.
+//Rectangles of equal height fill rows like a shelf packer, mixed heights fill the gaps.
+class SkylinePacker
+{
+private:
+	struct Segment
+	{
+		int x;
+		int y;
+		int width;
+	};
+
+	std::vector<Segment>	_skyline;
+	int						_width;
+	int						_height;
+
+	bool _fit(size_t index, int w, int h, int& y) const;
+
+public:
+	SkylinePacker(int w, int h);
+
+	void Reset(int w, int h);
+	//False when the rectangle does not fit anywhere
+	bool Insert(int w, int h, int& x, int& y);
+	int GetWidth() const;
+	int GetHeight() const;
+};
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "SourceExporter.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+struct CodeRange
+{
+	uint32_t	first;
+	uint32_t	count;
+	uint32_t	glyph;
+};
+
+static std::vector<CodeRange> makeRanges(const Font& font, size_t count)
+{
+	auto& seq = font.GetSequence();
+	std::vector<CodeRange> ranges;
+	if (seq.empty())
+	{
+		if (count > 0)
+			ranges.push_back({ 0, (uint32_t)count, 0 });
+		return ranges;
+	}
+
+	std::vector<std::pair<uint32_t, uint32_t>> codes;
+	for (size_t i = 0; i < seq.size() && i < count; i++)
+		codes.push_back({ font.IsUTF8() ? utf8char_to_codepoint(seq[i]) : (uint32_t)seq[i], (uint32_t)i });
+
+	//Duplicate codes resolve as in Font: the last glyph wins in UTF-8 fonts, the first one in 8-bit fonts.
+	//The sort is stable, so duplicates stay in glyph order.
+	std::stable_sort(codes.begin(), codes.end(), [](auto& a, auto& b) { return a.first < b.first; });
+	bool lastWins = font.IsUTF8();
+	for (size_t i = 0; i < codes.size(); i++)
+	{
+		if (lastWins ? i + 1 < codes.size() && codes[i + 1].first == codes[i].first : i > 0 && codes[i - 1].first == codes[i].first)
+			continue;
+
+		if (!ranges.empty())
+		{
+			auto& last = ranges.back();
+			if (codes[i].first == last.first + last.count && codes[i].second == last.glyph + last.count)
+			{
+				last.count++;
+				continue;
+			}
+		}
+		ranges.push_back({ codes[i].first, 1, codes[i].second });
+	}
+	return ranges;
+}
+
+bool isSourceIdentifier(const std::string& name)
+{
+	if (name.empty() || (name[0] >= '0' && name[0] <= '9'))
+		return false;
+	for (unsigned char c : name)
+	{
+		if (!(c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')))
+			return false;
+	}
+	return true;
+}
+
+std::string sourceIdentifierFromPath(const std::string& path)
+{
+	size_t start = path.find_last_of("/\\");
+	start = start == std::string::npos ? 0 : start + 1;
+	size_t end = path.find('.', start);
+	std::string name = path.substr(start, end == std::string::npos ? std::string::npos : end - start);
+
+	for (auto& c : name)
+	{
+		if (!(c >= '0' && c <= '9') && !isSourceIdentifier(std::string(1, c)))
+			c = '_';
+	}
+	if (name.empty() || (name[0] >= '0' && name[0] <= '9'))
+		name = "font_" + name;
+	return name;
+}
+
+void writeFontSource(FileWriter& out, const Font& font, const std::string& name, const std::string& comment)
+{
+	if (!isSourceIdentifier(name))
+		throw std::runtime_error("Not a valid identifier: " + name);
+
+	auto& bits = font.GetBits();
+	size_t glyphBits = size_t(font.GetWidth()) * font.GetHeight();
+	size_t glyphBytes = (glyphBits + 7) / 8;
+	size_t count = glyphBits ? bits.size() / glyphBits : 0;
+	auto ranges = makeRanges(font, count);
+
+	char buf[160];
+	out.Write("//Generated by fonted_export");
+	if (!comment.empty())
+		out.Write(" from " + comment);
+	snprintf(buf, sizeof(buf), "\n//%dx%d, interval %d, %zu glyphs, %zu bytes of glyph data\n", font.GetWidth(), font.GetHeight(), font.GetInterval(), count, count * glyphBytes);
+	out.Write(buf);
+	out.Write("#pragma once\n#include \"EmbeddedFont.h\"\n\n");
+
+	//One glyph per line, or 16 bytes per line for big glyphs
+	size_t perLine = glyphBytes <= 16 ? glyphBytes : 16;
+	out.Write("static constexpr uint8_t " + name + "_bits[] =\n{\n");
+	std::vector<unsigned char> packed(glyphBytes);
+	for (size_t g = 0; g < count; g++)
+	{
+		const unsigned char* src = &bits[g * glyphBits];
+		std::fill(packed.begin(), packed.end(), 0);
+		for (size_t i = 0; i < glyphBits; i++)
+		{
+			if (src[i] != 0)
+				packed[i / 8] |= 0x80 >> (i % 8);
+		}
+
+		for (size_t i = 0; i < glyphBytes; i++)
+		{
+			if (i % perLine == 0)
+				out.Put('\t');
+			snprintf(buf, sizeof(buf), "0x%02X,", packed[i]);
+			out.Write(buf);
+
+			if (i + 1 == glyphBytes)
+			{
+				snprintf(buf, sizeof(buf), "\t//%zu\n", g);
+				out.Write(buf);
+			}
+			else
+				out.Put((i + 1) % perLine == 0 ? '\n' : ' ');
+		}
+	}
+	if (count == 0)
+		out.Write("\t0\n");
+	out.Write("};\n\n");
+
+	out.Write("static constexpr EmbeddedGlyphRange " + name + "_ranges[] =\n{\n");
+	for (auto& r : ranges)
+	{
+		snprintf(buf, sizeof(buf), "\t{ 0x%04X, %u, %u },\n", r.first, r.count, r.glyph);
+		out.Write(buf);
+	}
+	if (ranges.empty())
+		out.Write("\t{ 0, 0, 0 }\n");
+	out.Write("};\n\n");
+
+	snprintf(buf, sizeof(buf), "{ %d, %d, %d, %s, ", font.GetWidth(), font.GetHeight(), font.GetInterval(), font.IsUTF8() ? "true" : "false");
+	out.Write("static constexpr EmbeddedFont " + name + " =\n\t" + buf);
+	snprintf(buf, sizeof(buf), "_ranges, %zu, ", ranges.size());
+	out.Write(name + buf);
+	snprintf(buf, sizeof(buf), "_bits, %zu };\n", count);
+	out.Write(name + buf);
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+#include <string>
+#include "Font.h"
+#include "FileWriter.h"
+
+//Writes a font as a C++ header for EmbeddedFont.h: the glyph bits as a constexpr byte array
+//in the .fntb layout, a table of code point ranges and the EmbeddedFont that ties them together.
+//UTF-8 sequence codes are stored as Unicode code points, 8-bit codes as they are.
+void writeFontSource(FileWriter& out, const Font& font, const std::string& name, const std::string& comment = "");
+bool isSourceIdentifier(const std::string& name);
+//File name without directories and extension, with everything a C identifier can't hold replaced by '_'
+std::string sourceIdentifierFromPath(const std::string& path);
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "Utils.h"
+
+//Font that lives entirely in constant data, built by the compiler from a packed literal.
+//Bits go row by row, MSB first, each glyph padded to a whole byte (the .fntb layout).
+//Glyphs are indexed by byte value like a Font without a sequence, missing ones fall back to '?'.
+//Nothing is parsed or allocated at runtime, VirtualCanvas draws it straight from the bits.
+template<int W, int H, size_t N>
+class StaticFont
+{
+public:
+	static constexpr size_t GlyphBytes() { return (size_t(W) * H + 7) / 8; }
+
+private:
+	uint8_t	_bits[N * GlyphBytes()];
+	int		_interval;
+
+public:
+	constexpr StaticFont(const uint8_t (&bits)[N * GlyphBytes()], int interval)
+		: _bits{}
+		, _interval(interval)
+	{
+		for (size_t i = 0; i < N * GlyphBytes(); i++)
+			_bits[i] = bits[i];
+	}
+
+	constexpr int GetWidth() const { return W; }
+	constexpr int GetHeight() const { return H; }
+	constexpr int GetInterval() const { return _interval; }
+	constexpr size_t CharCount() const { return N; }
+
+	//-1 when neither the character nor '?' is in the font
+	constexpr long FindGlyph(utf8char_t ch) const
+	{
+		ch &= 0xFF;
+		if (ch < N)
+			return long(ch);
+		return '?' < N ? long('?') : -1;
+	}
+
+	constexpr bool Pixel(size_t glyph, int x, int y) const
+	{
+		size_t bit = size_t(y) * W + x;
+		return (_bits[glyph * GlyphBytes() + bit / 8] >> (7 - bit % 8)) & 1;
+	}
+
+	constexpr bool ColumnEmpty(size_t glyph, int x) const
+	{
+		for (int y = 0; y < H; y++)
+		{
+			if (Pixel(glyph, x, y))
+				return false;
+		}
+		return true;
+	}
+
+	//Columns [left, right) that hold ink, blank glyphs keep their full width as in Font
+	constexpr void Trim(size_t glyph, int& left, int& right) const
+	{
+		left = 0;
+		right = W;
+		while (left < W && ColumnEmpty(glyph, left))
+			left++;
+		if (left == W)
+		{
+			left = 0;
+			return;
+		}
+		while (ColumnEmpty(glyph, right - 1))
+			right--;
+	}
+};
\ No newline at end of file
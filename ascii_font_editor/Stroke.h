@@ -0,0 +1,86 @@
+#pragma once
+#include <vector>
+#include <cstdlib>
+
+//Collects successive cursor samples of a freehand stroke as a polyline
+//and rasterizes all of its segments in one batch with Bresenham lines.
+//Joint pixels shared by two segments are plotted only once.
+class Stroke
+{
+public:
+	struct Point
+	{
+		int x;
+		int y;
+	};
+
+private:
+	std::vector<Point>	_points;
+	bool				_erase;
+
+	template<class Plot>
+	static void _segment(Point a, Point b, bool skipFirst, Plot& plot)
+	{
+		int dx = std::abs(b.x - a.x), sx = a.x < b.x ? 1 : -1;
+		int dy = -std::abs(b.y - a.y), sy = a.y < b.y ? 1 : -1;
+		int err = dx + dy;
+
+		for (;;)
+		{
+			if (!skipFirst)
+				plot(a.x, a.y);
+			skipFirst = false;
+
+			if (a.x == b.x && a.y == b.y)
+				break;
+
+			int e2 = 2 * err;
+			if (e2 >= dy)
+			{
+				err += dy;
+				a.x += sx;
+			}
+			if (e2 <= dx)
+			{
+				err += dx;
+				a.y += sy;
+			}
+		}
+	}
+
+public:
+	Stroke() : _erase(false) {}
+
+	bool IsEmpty() const { return _points.empty(); }
+	bool IsErasing() const { return _erase; }
+
+	//Returns false when the segment does not continue the current polyline
+	bool Continues(int x, int y, bool erase) const
+	{
+		return !_points.empty() && _erase == erase && _points.back().x == x && _points.back().y == y;
+	}
+
+	void Begin(int x, int y, bool erase)
+	{
+		_points.clear();
+		_points.push_back({ x, y });
+		_erase = erase;
+	}
+
+	void LineTo(int x, int y)
+	{
+		_points.push_back({ x, y });
+	}
+
+	template<class Plot>
+	void Flush(Plot plot)
+	{
+		if (_points.size() == 1)
+			plot(_points[0].x, _points[0].y);
+
+		for (size_t i = 1; i < _points.size(); i++)
+			_segment(_points[i - 1], _points[i], i > 1, plot);
+
+		_points.clear();
+	}
+};
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "Trace.h"
+
+#ifdef FONTED_TRACE
+
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <cstdio>
+
+namespace trace
+{
+	struct Event
+	{
+		const char*	name;
+		int64_t		start;
+		int64_t		end;
+	};
+
+	//One per thread, owned by the registry so spans survive the thread
+	struct ThreadLog
+	{
+		std::mutex			lock;
+		std::vector<Event>	events;
+		std::string			name;
+		int					tid;
+		size_t				dropped = 0;
+	};
+
+	//Keeps a runaway session from eating all memory, roughly 24 MB per thread
+	static constexpr const size_t MaxEvents = 1 << 20;
+
+	static std::mutex s_registryLock;
+	static std::vector<std::unique_ptr<ThreadLog>> s_logs;
+	static const auto s_epoch = std::chrono::steady_clock::now();
+
+	static ThreadLog& threadLog()
+	{
+		thread_local ThreadLog* log = nullptr;
+		if (!log)
+		{
+			std::lock_guard<std::mutex> guard(s_registryLock);
+			s_logs.push_back(std::make_unique<ThreadLog>());
+			log = s_logs.back().get();
+			log->tid = (int)s_logs.size();
+			log->events.reserve(4096);
+		}
+		return *log;
+	}
+
+	int64_t now()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_epoch).count();
+	}
+
+	void record(const char* name, int64_t startUs, int64_t endUs)
+	{
+		ThreadLog& log = threadLog();
+		std::lock_guard<std::mutex> guard(log.lock);
+		if (log.events.size() < MaxEvents)
+			log.events.push_back({ name, startUs, endUs });
+		else
+			log.dropped++;
+	}
+
+	void setThreadName(const char* name)
+	{
+		ThreadLog& log = threadLog();
+		std::lock_guard<std::mutex> guard(log.lock);
+		log.name = name;
+	}
+
+	static void writeString(FILE* f, const char* str)
+	{
+		fputc('"', f);
+		for (; *str; str++)
+		{
+			if (*str == '"' || *str == '\\')
+				fputc('\\', f);
+			if ((unsigned char)*str >= 0x20)
+				fputc(*str, f);
+		}
+		fputc('"', f);
+	}
+
+	bool write(const std::string& path)
+	{
+		FILE* f = fopen(path.c_str(), "wb");
+		if (!f)
+			return false;
+
+		fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+		bool first = true;
+		std::lock_guard<std::mutex> registryGuard(s_registryLock);
+		for (auto& log : s_logs)
+		{
+			std::lock_guard<std::mutex> guard(log->lock);
+			if (!log->name.empty())
+			{
+				fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", first ? "" : ",\n", log->tid);
+				writeString(f, log->name.c_str());
+				fputs("}}", f);
+				first = false;
+			}
+
+			for (auto& ev : log->events)
+			{
+				fprintf(f, "%s{\"name\":", first ? "" : ",\n");
+				writeString(f, ev.name);
+				fprintf(f, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%lld,\"dur\":%lld}", log->tid, (long long)ev.start, (long long)(ev.end - ev.start));
+				first = false;
+			}
+
+			if (log->dropped > 0)
+			{
+				fprintf(f, "%s{\"name\":\"dropped %zu spans\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%lld}",
+					first ? "" : ",\n", log->dropped, log->tid, log->events.empty() ? 0LL : (long long)log->events.back().end);
+				first = false;
+			}
+		}
+		fputs("\n]}\n", f);
+		return fclose(f) == 0;
+	}
+}
+
+#endif
\ No newline at end of file
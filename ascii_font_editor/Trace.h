@@ -0,0 +1,64 @@
+#pragma once
+
+//Scoped spans written as Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev).
+//Everything below compiles to nothing unless FONTED_TRACE is defined.
+//
+//	TRACE_THREAD("render");				names the calling thread in the timeline
+//	TRACE_SCOPE("Canvas::_draw");		span from here to the end of the block, name must be a literal
+//	TRACE_LOCK(_lock, "Canvas::_lock");	lock_guard that records the time spent waiting for the mutex
+//	TRACE_LOCK_ACQUIRE(_lock, "...");	same for manual lock()/unlock() pairs
+//	TRACE_WRITE("trace.json");			dumps the spans of all threads recorded so far
+
+#include <mutex>
+
+#define TRACE_CAT_(a, b) a##b
+#define TRACE_CAT(a, b) TRACE_CAT_(a, b)
+
+#ifdef FONTED_TRACE
+
+#include <cstdint>
+#include <string>
+
+namespace trace
+{
+	int64_t now();
+	void record(const char* name, int64_t startUs, int64_t endUs);
+	void setThreadName(const char* name);
+	bool write(const std::string& path);
+
+	class Scope
+	{
+	private:
+		const char*	_name;
+		int64_t		_start;
+
+	public:
+		Scope(const char* name) : _name(name), _start(now()) {}
+		~Scope() { record(_name, _start, now()); }
+	};
+
+	template<class Mutex>
+	Mutex& lockTimed(Mutex& mutex, const char* name)
+	{
+		int64_t start = now();
+		mutex.lock();
+		record(name, start, now());
+		return mutex;
+	}
+}
+
+#define TRACE_THREAD(name) trace::setThreadName(name)
+#define TRACE_SCOPE(name) trace::Scope TRACE_CAT(_traceScope, __LINE__)(name)
+#define TRACE_LOCK(m, name) std::lock_guard<std::mutex> TRACE_CAT(_traceGuard, __LINE__)(trace::lockTimed(m, name), std::adopt_lock)
+#define TRACE_LOCK_ACQUIRE(m, name) trace::lockTimed(m, name)
+#define TRACE_WRITE(path) trace::write(path)
+
+#else
+
+#define TRACE_THREAD(name) ((void)0)
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_LOCK(m, name) std::lock_guard<std::mutex> TRACE_CAT(_traceGuard, __LINE__)(m)
+#define TRACE_LOCK_ACQUIRE(m, name) (m).lock()
+#define TRACE_WRITE(path) ((void)0)
+
+#endif
\ No newline at end of file
@@ -1,29 +1,11 @@
 #include "Utils.h"
-#include <stdexcept>
-#include <commctrl.h>
-#include <richedit.h>
-#include <tlhelp32.h>
-#include <Shlwapi.h>
-#include <Shlobj.h>
-
-#ifdef _WIN64
-using flexInt = long long;
-using flexUint = unsigned long long;
-#else
-using flexInt = long;
-using flexUint = unsigned long;
-#endif
 
 void InitBitmap(bitmap_t& bmp, int h, int w)
 {
-	bmp.clear();
+	//Rows are kept, redrawing a bitmap of the same size does not allocate
 	bmp.resize(h);
 	for (auto& y : bmp)
-	{
-		y.resize(w);
-		for (auto& x : y)
-			x = 0;
-	}
+		y.assign(w, 0);
 }
 
 void RemoveBOMFromString(std::string& str)
@@ -31,7 +13,7 @@ void RemoveBOMFromString(std::string& str)
 	if (str.length() < 3)
 		return;
 
-	if (str[0] == 0xEF && str[1] == 0xBB && str[2] == 0xBF)
+	if ((unsigned char)str[0] == 0xEF && (unsigned char)str[1] == 0xBB && (unsigned char)str[2] == 0xBF)
 		str = str.substr(3, str.length() - 1);
 }
 
@@ -64,9 +46,8 @@ void enumerateUTF8String(const std::string& u8str, std::function<void(utf8char_t
 		else if ((u8str[i] & 0xe0) == 0xc0) cplen = 2;
 		if ((i + cplen) > u8str.length()) cplen = 1;
 		utf8char_t ch = 0;
-		auto sch = u8str.substr(i, cplen);
 		for (size_t k = 0; k < cplen; k++)
-			reinterpret_cast<char*>(&ch)[k] = sch[k];
+			reinterpret_cast<char*>(&ch)[k] = u8str[i + k];
 		callback(ch, n, cplen);
 		n++;
 		i += cplen;
@@ -89,6 +70,41 @@ std::string utf8char_to_stdString(utf8char_t ch)
 	return str;
 }
 
+//Bytes of the character are packed little endian
+uint32_t utf8char_to_codepoint(utf8char_t ch)
+{
+	unsigned char b[4] = { (unsigned char)(ch & 0xFF), (unsigned char)((ch >> 8) & 0xFF), (unsigned char)((ch >> 16) & 0xFF), (unsigned char)((ch >> 24) & 0xFF) };
+	int len = 1;
+	uint32_t cp = b[0];
+	if ((b[0] & 0xE0) == 0xC0) { len = 2; cp &= 0x1F; }
+	else if ((b[0] & 0xF0) == 0xE0) { len = 3; cp &= 0x0F; }
+	else if ((b[0] & 0xF8) == 0xF0) { len = 4; cp &= 0x07; }
+	else if (b[0] >= 0x80)
+		return (uint32_t)ch;
+
+	for (int i = 1; i < 4; i++)
+	{
+		if (i < len && (b[i] & 0xC0) != 0x80)
+			return (uint32_t)ch;
+		if (i >= len && b[i] != 0)
+			return (uint32_t)ch;
+		if (i < len)
+			cp = (cp << 6) | (b[i] & 0x3F);
+	}
+	return cp;
+}
+
+utf8char_t codepoint_to_utf8char(uint32_t cp)
+{
+	if (cp < 0x80)
+		return cp;
+	if (cp < 0x800)
+		return (0xC0 | (cp >> 6)) | ((0x80 | (cp & 0x3F)) << 8);
+	if (cp < 0x10000)
+		return (0xE0 | (cp >> 12)) | ((0x80 | ((cp >> 6) & 0x3F)) << 8) | ((0x80 | (cp & 0x3F)) << 16);
+	return (0xF0 | (cp >> 18)) | ((0x80 | ((cp >> 12) & 0x3F)) << 8) | ((0x80 | ((cp >> 6) & 0x3F)) << 16) | (utf8char_t(0x80 | (cp & 0x3F)) << 24);
+}
+
 std::vector<unsigned char> bmp2raw(const bitmap_t& bmp)
 {
 	if (bmp.size() == 0)
@@ -99,7 +115,7 @@ std::vector<unsigned char> bmp2raw(const bitmap_t& bmp)
 	{
 		for (size_t x = 0; x < bmp[0].size(); x++)
 		{
-			raw[y + x] = bmp[y][x];
+			raw[y * bmp[0].size() + x] = bmp[y][x];
 		}
 	}
 
@@ -129,182 +145,4 @@ void bmpUpscaleLinear(bitmap_t& bmp, int scale)
 	}
 
 	bmp = ups;
-}
-
-HWND CreateWindowElement(HWND Parent, UINT Type, const char* Title, HINSTANCE hInst, DWORD Style, DWORD StyleEx, HMENU ElementID, INT pos_x, INT pos_y, INT Width, INT Height, BOOL NewRadioGroup)
-{
-	HWND hWnd = NULL;
-	const char* ClassName = nullptr;
-
-	Style |= WS_CHILD;
-
-	switch (Type)
-	{
-	case ET_STATIC:
-		ClassName = "STATIC";
-		break;
-
-	case ET_BUTTON:
-		ClassName = "BUTTON";
-		break;
-
-	case ET_EDIT:
-		ClassName = "EDIT";
-		break;
-
-	case ET_COMBOBOX:
-		ClassName = "COMBOBOX";
-		break;
-
-	case ET_LISTBOX:
-		ClassName = "LISTBOX";
-		break;
-
-	case ET_MDICLIENT:
-		ClassName = "MDICLIENT";
-		break;
-
-	case ET_SCROLLBAR:
-		ClassName = "SCROLLBAR";
-		break;
-
-	case ET_CHECKBOX:
-		ClassName = "BUTTON";
-		Style |= BS_AUTOCHECKBOX;
-		break;
-
-	case ET_RADIOBUTTON:
-		ClassName = "BUTTON";
-		Style |= BS_AUTORADIOBUTTON;
-		if (NewRadioGroup)
-			Style |= WS_GROUP;
-		break;
-
-	case ET_GROUPBOX:
-		ClassName = "BUTTON";
-		Style |= BS_GROUPBOX;
-		break;
-
-	case ET_PROGRESS:
-		ClassName = PROGRESS_CLASSA;
-		break;
-
-
-	default: ClassName = "STATIC";
-	}
-
-	hWnd = CreateWindowExA(StyleEx, ClassName, Title, Style, pos_x, pos_y, Width, Height, Parent, ElementID, hInst, NULL);
-
-	if (!hWnd)
-		return nullptr;
-
-
-	if (NewRadioGroup)
-		CheckDlgButton(Parent, int((flexInt)ElementID), BST_CHECKED);
-
-	HFONT hFont = CreateFontA(13, 0, 0, 0, FW_DONTCARE, FALSE, FALSE, FALSE, ANSI_CHARSET,
-		OUT_TT_PRECIS, CLIP_DEFAULT_PRECIS, DEFAULT_QUALITY,
-		DEFAULT_PITCH | FF_DONTCARE, "Tahoma");
-	SendMessageA(hWnd, WM_SETFONT, (WPARAM)hFont, TRUE);
-
-	return hWnd;
-}
-
-std::string browse(HWND hwnd, HWND outputWindow, FileDialogType fdType)
-{
-	HRESULT hr = CoInitializeEx(NULL, COINIT_APARTMENTTHREADED |
-		COINIT_DISABLE_OLE1DDE);
-
-	COMDLG_FILTERSPEC rgSpecOpen[] =
-	{
-		{ L"Font (*.fnt)" , L"*.fnt" },
-		{ L"Text files (*.txt)" , L"*.txt" },
-		{ L"All files (*.*)" , L"*.*" },
-	};
-
-	COMDLG_FILTERSPEC rgSpecSave[] =
-	{
-		{ L"Font (*.fnt)" , L"*.fnt" },
-		{ L"Text files (*.txt)" , L"*.txt" }
-	};
-
-	const wchar_t defaultOpenFormat[] = L"*.txt;*.fnt";
-	const wchar_t defaultSaveFormat[] = L"";
-	FILEOPENDIALOGOPTIONS fopt = 0;
-	bool succeed = false;
-
-	if (SUCCEEDED(hr))
-	{
-		IFileDialog* pFileDialog;
-		std::string astr;
-		std::wstring wstr;
-
-		if (fdType == FileDialogType::Save)
-		{
-			hr = CoCreateInstance(CLSID_FileSaveDialog, NULL, CLSCTX_ALL,
-				IID_IFileSaveDialog, reinterpret_cast<void**>(&pFileDialog));
-		}
-		else
-		{
-			hr = CoCreateInstance(CLSID_FileOpenDialog, NULL, CLSCTX_ALL,
-				IID_IFileOpenDialog, reinterpret_cast<void**>(&pFileDialog));
-		}
-
-		if (SUCCEEDED(hr))
-		{
-			pFileDialog->GetOptions(&fopt);
-
-			if (fdType == FileDialogType::Save)
-			{
-				pFileDialog->SetFileTypes(ARRAYSIZE(rgSpecSave), rgSpecSave);
-				pFileDialog->SetDefaultExtension(defaultSaveFormat);
-				fopt |= FOS_PATHMUSTEXIST;
-			}
-			else if (fdType == FileDialogType::Open)
-			{
-				pFileDialog->SetFileTypes(ARRAYSIZE(rgSpecOpen), rgSpecOpen);
-				pFileDialog->SetDefaultExtension(defaultOpenFormat);
-				fopt |= FOS_FILEMUSTEXIST;
-			}
-			else
-				fopt |= FOS_PICKFOLDERS;
-			pFileDialog->SetFileTypeIndex(0);
-			pFileDialog->SetOptions(fopt);
-
-			hr = pFileDialog->Show(hwnd);
-
-			if (SUCCEEDED(hr))
-			{
-				IShellItem* pItem;
-				wchar_t* pszFilePath = nullptr;
-				hr = pFileDialog->GetResult(&pItem);
-				if (SUCCEEDED(hr))
-				{
-					hr = pItem->GetDisplayName(SIGDN_FILESYSPATH, &pszFilePath);
-
-					if (SUCCEEDED(hr))
-					{
-						wstr = pszFilePath;
-						CoTaskMemFree(pszFilePath);
-						succeed = true;
-					}
-
-					pItem->Release();
-				}
-			}
-			pFileDialog->Release();
-		}
-		CoUninitialize();
-
-		if (succeed)
-		{
-			astr.resize(wstr.size() + 1);
-			SetWindowTextW(outputWindow, wstr.c_str());
-			GetWindowTextA(outputWindow, &astr[0], int(astr.size()));
-		}
-
-		return astr;
-	}
-
-	return "";
 }
\ No newline at end of file
@@ -1,4 +1,3 @@
-#pragma once
 #include "VirtualCanvas.h"
 #include "Utils.h"
 #include <cmath>
@@ -32,50 +31,61 @@ VirtualCanvas::Dims VirtualCanvas::DrawRect(int a_x, int a_y, int b_x, int b_y,
 	return { a_x, a_y, b_x, b_y };
 }
 
-VirtualCanvas::Dims VirtualCanvas::DrawTextRegular(const Font& font, const std::string& text, int off_x, int off_y, int brush, bool invert, bool monospace)
+//Walks the text glyph by glyph, UTF-8 fonts get whole code points, other fonts get bytes.
+//Calls place(letter, x, y) for every glyph and returns the bounding box of all lines.
+template<class Place>
+static VirtualCanvas::Dims layoutText(const Font& font, const std::string& text, int off_x, int off_y, bool monospace, Place place)
 {
 	int fh = font.GetHeight();
-	Dims dims;
-	dims.a_x = off_x;
-	dims.a_y = off_y;
-	dims.b_x = off_x;
-	dims.b_y = off_y + fh;
+	VirtualCanvas::Dims dims = { off_x, off_y, off_x, off_y + fh };
 	int initialX = off_x;
 
-	int cur_row_w = off_x;
-	for (size_t i = 0; i < text.length(); i++)
+	auto glyph = [&](utf8char_t c)
 	{
-		char c = text[i];
-		auto letter = font.GetCharImage_8bit((unsigned char)c, monospace);
-
-		if (letter.empty())
-			continue;
-
-		int fw = (int)letter[0].size();
-
 		if (c == '\r')
-			continue;
+			return;
 
 		if (c == '\n')
 		{
 			off_y += 1 + fh;
 			dims.b_y += 1 + fh;
-			
-
-			if (cur_row_w > dims.b_x)
-				dims.b_x = cur_row_w;
-
+			dims.b_x = Max(dims.b_x, off_x);
 			off_x = initialX;
-			cur_row_w = initialX;
-			continue;
+			return;
 		}
 
-		for (int y = 0; y < fh; y++)
+		//The glyph image only lives until it is placed, on a render thread it comes from the frame arena
+		TransientScope transient;
+		auto letter = font.GetCharImage_8bit(c, monospace);
+		if (letter.empty())
+			return;
+
+		place(letter, off_x, off_y);
+		off_x += (int)letter[0].size() + font.GetInterval();
+	};
+
+	if (font.IsUTF8())
+		enumerateUTF8String(text, [&](utf8char_t ch, size_t, size_t) { glyph(ch); });
+	else
+	{
+		for (size_t i = 0; i < text.length(); i++)
+			glyph((unsigned char)text[i]);
+	}
+
+	dims.b_x = Max(dims.b_x, off_x);
+	return dims;
+}
+
+VirtualCanvas::Dims VirtualCanvas::DrawTextRegular(const Font& font, const std::string& text, int off_x, int off_y, int brush, bool invert, bool monospace)
+{
+	return layoutText(font, text, off_x, off_y, monospace, [&](const bitmap_t& letter, int px, int py)
+	{
+		for (int y = 0; y < (int)letter.size(); y++)
 		{
-			for (int x = 0; x < fw; x++)
+			for (int x = 0; x < (int)letter[y].size(); x++)
 			{
-				int pos_x = x + off_x;
-				int pos_y = y + off_y;
+				int pos_x = x + px;
+				int pos_y = y + py;
 				if (pos_x >= _width || pos_y >= _height || pos_x < 0 || pos_y < 0)
 					break;
 
@@ -84,13 +94,12 @@ VirtualCanvas::Dims VirtualCanvas::DrawTextRegular(const Font& font, const std::
 					_canvas[pos_y][pos_x] = brush;
 			}
 		}
-		off_x += fw + font.GetInterval();
-		cur_row_w += fw + font.GetInterval();
-	}
+	});
+}
 
-	if (dims.b_x == initialX)
-		dims.b_x = cur_row_w;
-	return dims;
+VirtualCanvas::Dims VirtualCanvas::MeasureText(const Font& font, const std::string& text, bool monospace)
+{
+	return layoutText(font, text, 0, 0, monospace, [](const bitmap_t&, int, int) {});
 }
 
 void VirtualCanvas::Clear()
@@ -105,7 +114,7 @@ void VirtualCanvas::ReInit(int w, int h)
 	InitBitmap(_canvas, _height, _width);
 }
 
-const std::vector<pixel_t>& VirtualCanvas::operator[](size_t i) const
+const pixel_row_t& VirtualCanvas::operator[](size_t i) const
 {
 	return _canvas[i];
 }
@@ -113,4 +122,14 @@ const std::vector<pixel_t>& VirtualCanvas::operator[](size_t i) const
 const size_t VirtualCanvas::size() const
 {
 	return _canvas.size();
+}
+
+int VirtualCanvas::GetWidth() const
+{
+	return _width;
+}
+
+int VirtualCanvas::GetHeight() const
+{
+	return _height;
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Font.h"
+#include "StaticFont.h"
 
 class VirtualCanvas
 {
@@ -20,6 +21,42 @@ private:
 	VirtualCanvas(VirtualCanvas&) = delete;
 	VirtualCanvas& operator=(VirtualCanvas&) = delete;
 
+	//Same layout as for Font, place(glyph, left, right, x, y) gets the glyph columns [left, right)
+	template<int W, int H, size_t N, class Place>
+	static Dims _layoutStatic(const StaticFont<W, H, N>& font, const std::string& text, int off_x, int off_y, bool monospace, Place place)
+	{
+		Dims dims = { off_x, off_y, off_x, off_y + H };
+		int initialX = off_x;
+		for (unsigned char c : text)
+		{
+			if (c == '\r')
+				continue;
+
+			if (c == '\n')
+			{
+				off_y += 1 + H;
+				dims.b_y += 1 + H;
+				dims.b_x = Max(dims.b_x, off_x);
+				off_x = initialX;
+				continue;
+			}
+
+			long glyph = font.FindGlyph(c);
+			if (glyph < 0)
+				continue;
+
+			int left = 0, right = W;
+			if (!monospace)
+				font.Trim(size_t(glyph), left, right);
+
+			place(size_t(glyph), left, right, off_x, off_y);
+			off_x += right - left + font.GetInterval();
+		}
+
+		dims.b_x = Max(dims.b_x, off_x);
+		return dims;
+	}
+
 public:
 	VirtualCanvas(int w, int h);
 	~VirtualCanvas();
@@ -27,10 +64,79 @@ public:
 	bitmap_t GetBitmap() const;
 
 	Dims DrawTextRegular(const Font& font, const std::string& text, int off_x, int off_y, int brush = 1, bool invert = false, bool monospace = false);
+	static Dims MeasureText(const Font& font, const std::string& text, bool monospace = false);
+
+	//Compile time fonts are drawn straight from their bits, no glyph images are built
+	template<int W, int H, size_t N>
+	Dims DrawTextRegular(const StaticFont<W, H, N>& font, const std::string& text, int off_x, int off_y, int brush = 1, bool invert = false, bool monospace = false)
+	{
+		return _layoutStatic(font, text, off_x, off_y, monospace, [&](size_t glyph, int left, int right, int px, int py)
+		{
+			for (int y = 0; y < H; y++)
+			{
+				int pos_y = y + py;
+				if (pos_y < 0 || pos_y >= _height)
+					continue;
+
+				for (int x = left; x < right; x++)
+				{
+					int pos_x = x - left + px;
+					if (pos_x < 0 || pos_x >= _width)
+						break;
+
+					if (font.Pixel(glyph, x, y) != invert)
+						_canvas[pos_y][pos_x] = brush;
+				}
+			}
+		});
+	}
+
+	template<int W, int H, size_t N>
+	static Dims MeasureText(const StaticFont<W, H, N>& font, const std::string& text, bool monospace = false)
+	{
+		return _layoutStatic(font, text, 0, 0, monospace, [](size_t, int, int, int, int) {});
+	}
 	Dims DrawRect(int a_x, int a_y, int b_x, int b_y, int brush);
 	void Clear();
 	void ReInit(int w, int h);
 
-	const std::vector<pixel_t>& operator[](size_t i) const;
+	const pixel_row_t& operator[](size_t i) const;
 	const size_t size() const;
+	int GetWidth() const;
+	int GetHeight() const;
+
+	//Palette maps a pixel value to a color, 0 leaves the surface pixel untouched
+	template<class Surface, class Palette>
+	void Present(Surface& surface, Palette palette, int scale = 1, int maxW = -1, int maxH = -1, int offsetY = 0) const
+	{
+		int h = maxH < 0 ? _height : Min(maxH, _height);
+		int w = maxW < 0 ? _width : Min(maxW, _width);
+		for (int y = 0; y < h; y++)
+		{
+			const pixel_t* row = _canvas[y].data();
+			for (int x = 0; x < w; x++)
+			{
+				uint32_t color = palette(row[x]);
+				if (color != 0)
+					surfaceFillScaled(surface, x, y + offsetY, scale, color);
+			}
+		}
+	}
+
+	//Coverage mask: set pixels get color, any color including 0, the rest is left untouched
+	template<class Surface>
+	void PresentMask(Surface& surface, uint32_t color, int scale = 1, int maxW = -1, int maxH = -1, int offsetY = 0) const
+	{
+		int h = maxH < 0 ? _height : Min(maxH, _height);
+		int w = maxW < 0 ? _width : Min(maxW, _width);
+		for (int y = 0; y < h; y++)
+		{
+			const pixel_t* row = _canvas[y].data();
+			for (int x = 0; x < w; x++)
+			{
+				if (row[x] > 0)
+					surfaceFillScaled(surface, x, y + offsetY, scale, color);
+			}
+		}
+	}
 };
\ No newline at end of file
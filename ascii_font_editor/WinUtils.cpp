@@ -0,0 +1,197 @@
+#include "WinUtils.h"
+#include <commctrl.h>
+#include <richedit.h>
+#include <tlhelp32.h>
+#include <Shlwapi.h>
+#include <Shlobj.h>
+
+#ifdef _WIN64
+using flexInt = long long;
+using flexUint = unsigned long long;
+#else
+using flexInt = long;
+using flexUint = unsigned long;
+#endif
+
+HWND CreateWindowElement(HWND Parent, UINT Type, const char* Title, HINSTANCE hInst, DWORD Style, DWORD StyleEx, HMENU ElementID, INT pos_x, INT pos_y, INT Width, INT Height, BOOL NewRadioGroup)
+{
+	HWND hWnd = NULL;
+	const char* ClassName = nullptr;
+
+	Style |= WS_CHILD;
+
+	switch (Type)
+	{
+	case ET_STATIC:
+		ClassName = "STATIC";
+		break;
+
+	case ET_BUTTON:
+		ClassName = "BUTTON";
+		break;
+
+	case ET_EDIT:
+		ClassName = "EDIT";
+		break;
+
+	case ET_COMBOBOX:
+		ClassName = "COMBOBOX";
+		break;
+
+	case ET_LISTBOX:
+		ClassName = "LISTBOX";
+		break;
+
+	case ET_MDICLIENT:
+		ClassName = "MDICLIENT";
+		break;
+
+	case ET_SCROLLBAR:
+		ClassName = "SCROLLBAR";
+		break;
+
+	case ET_CHECKBOX:
+		ClassName = "BUTTON";
+		Style |= BS_AUTOCHECKBOX;
+		break;
+
+	case ET_RADIOBUTTON:
+		ClassName = "BUTTON";
+		Style |= BS_AUTORADIOBUTTON;
+		if (NewRadioGroup)
+			Style |= WS_GROUP;
+		break;
+
+	case ET_GROUPBOX:
+		ClassName = "BUTTON";
+		Style |= BS_GROUPBOX;
+		break;
+
+	case ET_PROGRESS:
+		ClassName = PROGRESS_CLASSA;
+		break;
+
+
+	default: ClassName = "STATIC";
+	}
+
+	hWnd = CreateWindowExA(StyleEx, ClassName, Title, Style, pos_x, pos_y, Width, Height, Parent, ElementID, hInst, NULL);
+
+	if (!hWnd)
+		return nullptr;
+
+
+	if (NewRadioGroup)
+		CheckDlgButton(Parent, int((flexInt)ElementID), BST_CHECKED);
+
+	HFONT hFont = CreateFontA(13, 0, 0, 0, FW_DONTCARE, FALSE, FALSE, FALSE, ANSI_CHARSET,
+		OUT_TT_PRECIS, CLIP_DEFAULT_PRECIS, DEFAULT_QUALITY,
+		DEFAULT_PITCH | FF_DONTCARE, "Tahoma");
+	SendMessageA(hWnd, WM_SETFONT, (WPARAM)hFont, TRUE);
+
+	return hWnd;
+}
+
+std::string browse(HWND hwnd, HWND outputWindow, FileDialogType fdType)
+{
+	HRESULT hr = CoInitializeEx(NULL, COINIT_APARTMENTTHREADED |
+		COINIT_DISABLE_OLE1DDE);
+
+	COMDLG_FILTERSPEC rgSpecOpen[] =
+	{
+		{ L"Font (*.fnt)" , L"*.fnt" },
+		{ L"Text files (*.txt)" , L"*.txt" },
+		{ L"Packed font (*.fntb)" , L"*.fntb" },
+		{ L"Console font (*.psf)" , L"*.psf" },
+		{ L"X11 font (*.bdf)" , L"*.bdf" },
+		{ L"All files (*.*)" , L"*.*" },
+	};
+
+	COMDLG_FILTERSPEC rgSpecSave[] =
+	{
+		{ L"Font (*.fnt)" , L"*.fnt" },
+		{ L"Text files (*.txt)" , L"*.txt" },
+		{ L"Console font (*.psf)" , L"*.psf" },
+		{ L"X11 font (*.bdf)" , L"*.bdf" }
+	};
+
+	const wchar_t defaultOpenFormat[] = L"*.txt;*.fnt;*.fntb;*.psf;*.bdf";
+	const wchar_t defaultSaveFormat[] = L"";
+	FILEOPENDIALOGOPTIONS fopt = 0;
+	bool succeed = false;
+
+	if (SUCCEEDED(hr))
+	{
+		IFileDialog* pFileDialog;
+		std::string astr;
+		std::wstring wstr;
+
+		if (fdType == FileDialogType::Save)
+		{
+			hr = CoCreateInstance(CLSID_FileSaveDialog, NULL, CLSCTX_ALL,
+				IID_IFileSaveDialog, reinterpret_cast<void**>(&pFileDialog));
+		}
+		else
+		{
+			hr = CoCreateInstance(CLSID_FileOpenDialog, NULL, CLSCTX_ALL,
+				IID_IFileOpenDialog, reinterpret_cast<void**>(&pFileDialog));
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			pFileDialog->GetOptions(&fopt);
+
+			if (fdType == FileDialogType::Save)
+			{
+				pFileDialog->SetFileTypes(ARRAYSIZE(rgSpecSave), rgSpecSave);
+				pFileDialog->SetDefaultExtension(defaultSaveFormat);
+				fopt |= FOS_PATHMUSTEXIST;
+			}
+			else if (fdType == FileDialogType::Open)
+			{
+				pFileDialog->SetFileTypes(ARRAYSIZE(rgSpecOpen), rgSpecOpen);
+				pFileDialog->SetDefaultExtension(defaultOpenFormat);
+				fopt |= FOS_FILEMUSTEXIST;
+			}
+			else
+				fopt |= FOS_PICKFOLDERS;
+			pFileDialog->SetFileTypeIndex(0);
+			pFileDialog->SetOptions(fopt);
+
+			hr = pFileDialog->Show(hwnd);
+
+			if (SUCCEEDED(hr))
+			{
+				IShellItem* pItem;
+				wchar_t* pszFilePath = nullptr;
+				hr = pFileDialog->GetResult(&pItem);
+				if (SUCCEEDED(hr))
+				{
+					hr = pItem->GetDisplayName(SIGDN_FILESYSPATH, &pszFilePath);
+
+					if (SUCCEEDED(hr))
+					{
+						wstr = pszFilePath;
+						CoTaskMemFree(pszFilePath);
+						succeed = true;
+					}
+
+					pItem->Release();
+				}
+			}
+			pFileDialog->Release();
+		}
+		CoUninitialize();
+
+		if (succeed)
+		{
+			astr.resize(wstr.size() + 1);
+			SetWindowTextW(outputWindow, wstr.c_str());
+			GetWindowTextA(outputWindow, &astr[0], int(astr.size()));
+		}
+
+		return astr;
+	}
+
+	return "";
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+#include <Windows.h>
+
+#define ET_STATIC						0
+#define ET_EDIT							1
+#define ET_COMBOBOX						2
+#define ET_LISTBOX						3
+#define ET_MDICLIENT					4
+#define ET_SCROLLBAR					5
+#define ET_BUTTON						6
+#define ET_CHECKBOX						7
+#define ET_RADIOBUTTON					8
+#define ET_GROUPBOX						9
+#define ET_RICHEDIT						10
+#define ET_PROGRESS						11
+#define ET_SLIDER_V						12
+#define ET_SLIDER_H						13
+
+enum class FileDialogType
+{
+	Open,
+	Save,
+	SelectFolder
+};
+
+HWND CreateWindowElement(HWND Parent, UINT Type, const char* Title, HINSTANCE hInst, DWORD Style, DWORD StyleEx, HMENU ElementID, INT pos_x, INT pos_y, INT Width, INT Height, BOOL NewRadioGroup);
+std::string browse(HWND hwnd, HWND outputWindow, FileDialogType fdType);
\ No newline at end of file
@@ -0,0 +1,311 @@
+#include "Workspace.h"
+#include "EditJournal.h"
+#include <algorithm>
+
+//History tile size of a blank canvas
+static const int s_blankTile = 16;
+
+Workspace::Workspace()
+	: _width(0)
+	, _height(0)
+	, _clipboardCells(0)
+	, _generation(0)
+{
+}
+
+void Workspace::_replaced()
+{
+	//A blank canvas has no cells, the history tracks it in tiles so an edit records only what it touched
+	if (_geom.IsEmpty())
+		_history.Reset(_width, _height, s_blankTile);
+	else
+		_history.Reset(_geom);
+	_stroke = Stroke();
+	_generation++;
+	_dirty.clear();
+	_dirtyFlags.assign(_geom.Count(), 0);
+}
+
+void Workspace::Load(const bitmap_t& picture, int cellH, int cellW, int count)
+{
+	AllocScope scope(AllocTag::Workspace);
+	//Font tables come with grid (3) and empty cell (5) markers, keep only glyph bits
+	_frame = picture;
+	for (auto& row : _frame)
+	{
+		for (auto& px : row)
+			px = px == 1 ? 1 : 0;
+	}
+
+	_height = (int)_frame.size();
+	_width = _frame.empty() ? 0 : (int)_frame[0].size();
+	_geom = CellGeometry(cellH, cellW, count, _width);
+	_replaced();
+}
+
+void Workspace::Reset(int w, int h)
+{
+	AllocScope scope(AllocTag::Workspace);
+	InitBitmap(_frame, h, w);
+	_height = h;
+	_width = w;
+	_geom = CellGeometry();
+	_replaced();
+}
+
+void Workspace::ClearClipboard()
+{
+	_clipboard.clear();
+	_clipboardCells = 0;
+}
+
+void Workspace::ApplyAll(SpscQueue<EditCommand>& edits)
+{
+	EditCommand cmd;
+	while (edits.Pop(cmd))
+		Apply(cmd);
+	_flushStroke();
+}
+
+void Workspace::Apply(const EditCommand& cmd)
+{
+	AllocScope scope(AllocTag::Workspace);
+	//Consecutive segments of a stroke are collected and rasterized together
+	if (cmd.op == EditOp::Line)
+	{
+		if (!_stroke.Continues(cmd.x0, cmd.y0, cmd.erase))
+		{
+			_flushStroke();
+			_stroke.Begin(cmd.x0, cmd.y0, cmd.erase);
+		}
+		_stroke.LineTo(cmd.x1, cmd.y1);
+		return;
+	}
+
+	_flushStroke();
+	switch (cmd.op)
+	{
+	case EditOp::BeginStroke:
+		_history.Commit(_frame);
+		_history.Begin();
+		return;
+
+	case EditOp::EndStroke:
+		_history.Commit(_frame);
+		return;
+
+	case EditOp::Undo:
+	case EditOp::Redo:
+		_history.Commit(_frame);
+		_changed.clear();
+		if (cmd.op == EditOp::Undo)
+			_history.Undo(_frame, &_changed);
+		else
+			_history.Redo(_frame, &_changed);
+		for (int cell : _changed)
+			_markDirty(cell);
+		return;
+
+	default:
+		break;
+	}
+
+	//Edits outside of a stroke are undone one by one
+	bool single = !_history.IsOpen();
+	if (single)
+		_history.Begin();
+
+	switch (cmd.op)
+	{
+	case EditOp::SetPixel:
+		_plot(cmd.x0, cmd.y0, 1);
+		break;
+
+	case EditOp::Erase:
+		_plot(cmd.x0, cmd.y0, 0);
+		break;
+
+	case EditOp::CopyCells:
+		_copyCells(cmd);
+		break;
+
+	case EditOp::PasteCells:
+		_pasteCells(cmd);
+		break;
+
+	case EditOp::SwapCells:
+		_swapCells(cmd);
+		break;
+
+	case EditOp::FillCells:
+		_fillCells(cmd, 1);
+		break;
+
+	case EditOp::ClearCells:
+		_fillCells(cmd, 0);
+		break;
+
+	default:
+		break;
+	}
+
+	if (single)
+		_history.Commit(_frame);
+}
+
+void Workspace::_touch(int cell)
+{
+	_history.Touch(_frame, cell);
+	_markDirty(cell);
+}
+
+void Workspace::_markDirty(int cell)
+{
+	if (cell < 0 || cell >= (int)_dirtyFlags.size() || _dirtyFlags[cell])
+		return;
+
+	_dirtyFlags[cell] = 1;
+	_dirty.push_back(cell);
+}
+
+void Workspace::_plot(int x, int y, pixel_t px)
+{
+	if (x < 0 || y < 0 || x >= _width || y >= _height)
+		return;
+
+	//Grid lines and empty cells are overlay only, nothing to paint there
+	CellGeometry::Cell cell;
+	if (_geom.IsEmpty())
+		cell.index = (y / s_blankTile) * ((_width + s_blankTile - 1) / s_blankTile) + x / s_blankTile;
+	else if (!_geom.Locate(x, y, cell))
+		return;
+
+	_touch(cell.index);
+	_frame[y][x] = px;
+}
+
+void Workspace::_flushStroke()
+{
+	pixel_t px = _stroke.IsErasing() ? 0 : 1;
+	_stroke.Flush([this, px](int x, int y) { _plot(x, y, px); });
+}
+
+//Cells between the anchor and the cell under the point, or just the cell under the point
+bool Workspace::_cellRange(const EditCommand& cmd, int& first, int& last) const
+{
+	CellGeometry::Cell a, b;
+	if (!_geom.Locate(cmd.x0, cmd.y0, a) || !_geom.Locate(cmd.x1, cmd.y1, b))
+		return false;
+
+	first = Min(a.index, b.index);
+	last = Max(a.index, b.index);
+	return true;
+}
+
+void Workspace::_copyCells(const EditCommand& cmd)
+{
+	int first, last;
+	if (!_cellRange(cmd, first, last))
+		return;
+
+	int w = _geom.CellWidth(), h = _geom.CellHeight();
+	_clipboardCells = last - first + 1;
+	_clipboard.resize(size_t(_clipboardCells) * w * h);
+
+	auto out = _clipboard.begin();
+	for (int i = first; i <= last; i++)
+	{
+		int ox = _geom.OriginX(i), oy = _geom.OriginY(i);
+		for (int y = 0; y < h; y++)
+			out = std::copy(_frame[oy + y].begin() + ox, _frame[oy + y].begin() + ox + w, out);
+	}
+}
+
+void Workspace::_pasteCells(const EditCommand& cmd)
+{
+	CellGeometry::Cell target;
+	if (_clipboardCells == 0 || !_geom.Locate(cmd.x0, cmd.y0, target))
+		return;
+
+	int w = _geom.CellWidth(), h = _geom.CellHeight();
+	int cells = Min(_clipboardCells, _geom.Count() - target.index);
+
+	auto in = _clipboard.begin();
+	for (int i = target.index; i < target.index + cells; i++)
+	{
+		int ox = _geom.OriginX(i), oy = _geom.OriginY(i);
+		_touch(i);
+		for (int y = 0; y < h; y++, in += w)
+			std::copy(in, in + w, _frame[oy + y].begin() + ox);
+	}
+}
+
+void Workspace::_swapCells(const EditCommand& cmd)
+{
+	CellGeometry::Cell a, b;
+	if (!_geom.Locate(cmd.x0, cmd.y0, a) || !_geom.Locate(cmd.x1, cmd.y1, b) || a.index == b.index)
+		return;
+
+	int w = _geom.CellWidth(), h = _geom.CellHeight();
+	int ax = _geom.OriginX(a.index), ay = _geom.OriginY(a.index);
+	int bx = _geom.OriginX(b.index), by = _geom.OriginY(b.index);
+	_touch(a.index);
+	_touch(b.index);
+	for (int y = 0; y < h; y++)
+		std::swap_ranges(_frame[ay + y].begin() + ax, _frame[ay + y].begin() + ax + w, _frame[by + y].begin() + bx);
+}
+
+void Workspace::_fillCells(const EditCommand& cmd, pixel_t px)
+{
+	int first, last;
+	if (!_cellRange(cmd, first, last))
+		return;
+
+	int w = _geom.CellWidth(), h = _geom.CellHeight();
+	for (int i = first; i <= last; i++)
+	{
+		int ox = _geom.OriginX(i), oy = _geom.OriginY(i);
+		_touch(i);
+		for (int y = 0; y < h; y++)
+			std::fill(_frame[oy + y].begin() + ox, _frame[oy + y].begin() + ox + w, px);
+	}
+}
+
+const bitmap_t& Workspace::GetPicture() const
+{
+	return _frame;
+}
+
+const CellGeometry& Workspace::GetGeometry() const
+{
+	return _geom;
+}
+
+uint32_t Workspace::GetGeneration() const
+{
+	return _generation;
+}
+
+uint32_t Workspace::TakeDirtyCells(std::vector<int>& cells, std::vector<uint8_t>& bits)
+{
+	size_t cellBytes = EditJournal::CellBytes(_geom.CellWidth(), _geom.CellHeight());
+	cells.clear();
+	bits.resize(_dirty.size() * cellBytes);
+	for (size_t i = 0; i < _dirty.size(); i++)
+	{
+		EditJournal::PackCell(_frame, _geom, _dirty[i], &bits[i * cellBytes]);
+		_dirtyFlags[_dirty[i]] = 0;
+	}
+	cells.swap(_dirty);
+	return _generation;
+}
+
+int Workspace::GetWidth() const
+{
+	return _width;
+}
+
+int Workspace::GetHeight() const
+{
+	return _height;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "Utils.h"
+#include "EditQueue.h"
+#include "Stroke.h"
+#include "CellGeometry.h"
+#include "EditHistory.h"
+
+//Glyph data of an editor workspace and everything that edits it.
+//Holds only glyph bits (0/1) laid out as a font table, grid and cursor
+//decorations are composited by Present and never stored.
+//Not thread safe, Canvas serializes access with its own lock.
+class Workspace
+{
+public:
+	struct View
+	{
+		int			pointX;
+		int			pointY;
+		bool		helper;
+		bool		marker;
+		bool		anchored;
+		int			anchorX;
+		int			anchorY;
+		uint32_t	brush;
+	};
+
+private:
+	bitmap_t				_frame;
+	int						_width;
+	int						_height;
+	CellGeometry			_geom;
+	EditHistory				_history;
+	Stroke					_stroke;
+	pixel_row_t				_clipboard;	//Copied cells, one cell after another
+	int						_clipboardCells;
+	uint32_t				_generation;	//Bumped whenever the glyph layer is replaced
+	std::vector<int>		_dirty;			//Cells changed since the last TakeDirtyCells
+	std::vector<uint8_t>	_dirtyFlags;
+	std::vector<int>		_changed;		//Cells toggled by undo/redo
+
+	Workspace(Workspace&) = delete;
+	Workspace& operator=(Workspace&) = delete;
+
+	void _touch(int cell);
+	void _markDirty(int cell);
+	void _replaced();
+	void _plot(int x, int y, pixel_t px);
+	void _flushStroke();
+	bool _cellRange(const EditCommand& cmd, int& first, int& last) const;
+	void _copyCells(const EditCommand& cmd);
+	void _pasteCells(const EditCommand& cmd);
+	void _swapCells(const EditCommand& cmd);
+	void _fillCells(const EditCommand& cmd, pixel_t px);
+
+public:
+	Workspace();
+
+	void Load(const bitmap_t& picture, int cellH, int cellW, int count);
+	void Reset(int w, int h);
+	void ClearClipboard();
+	void Apply(const EditCommand& cmd);		//Line segments wait for the next non-line edit or the end of ApplyAll
+	void ApplyAll(SpscQueue<EditCommand>& edits);
+
+	const bitmap_t& GetPicture() const;
+	const CellGeometry& GetGeometry() const;
+	uint32_t GetGeneration() const;
+	//Moves out the cells changed since the last call, packed with EditJournal::PackCell one after another
+	uint32_t TakeDirtyCells(std::vector<int>& cells, std::vector<uint8_t>& bits);
+	int GetWidth() const;
+	int GetHeight() const;
+
+	//Surface is anything with setPixel(x, y, color): pw::PixelWindow, OffscreenWindow
+	template<class Surface>
+	void Present(Surface& surface, const View& view, int scale = 1, int offsetY = 0) const
+	{
+		bool layout = !_geom.IsEmpty();
+		int cw = _geom.CellWidth(), ch = _geom.CellHeight();
+
+		int selFirst = -1, selLast = -1;
+		CellGeometry::Cell a, b;
+		if (view.anchored && _geom.Locate(view.anchorX, view.anchorY, a) && _geom.Locate(view.pointX, view.pointY, b))
+		{
+			selFirst = Min(a.index, b.index);
+			selLast = Max(a.index, b.index);
+		}
+
+		for (int y = 0; y < _height; y++)
+		{
+			bool gridRow = layout && y % (ch + 1) == ch;
+			int rowFirstCell = layout ? (y / (ch + 1)) * _geom.Columns() : 0;
+			bool helperRow = view.helper && y == view.pointY;
+			const pixel_t* row = _frame[y].data();
+
+			for (int x = 0, lx = 0, cell = rowFirstCell; x < _width; x++, lx++)
+			{
+				if (lx == cw + 1)
+				{
+					lx = 0;
+					cell++;
+				}
+
+				bool grid = gridRow || (layout && lx == cw);
+				bool empty = !grid && layout && cell >= _geom.Count();
+				bool selected = !grid && cell >= selFirst && cell <= selLast;
+				uint32_t color = 0;
+
+				if (grid)
+					color = 0xFF0000BA;
+				else if (empty)
+					color = 0x55555555;
+				else if (helperRow || (view.helper && x == view.pointX))
+					color = row[x] ? 0xFFCC95AC : 0xFF000055;
+				else if (row[x])
+					color = view.brush;
+				else if (selected)
+					color = 0xFF2A1A1A;
+
+				if (view.marker && x == view.pointX && y == view.pointY)
+					color = color == 0 ? 0xFF00FF00 : 0xFF008800;
+
+				if (color != 0)
+					surfaceFillScaled(surface, x, y + offsetY, scale, color);
+			}
+		}
+	}
+};
\ No newline at end of file
@@ -1,17 +1,19 @@
 #include <iostream>
 #include "Application.h"
+#include "Trace.h"
 
 INT WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd)
 {
+	TRACE_THREAD("main");
 	try
 	{ 
 		Application app;
-		while (app.ProcessEventLoop())
-			Sleep(1);
+		while (app.ProcessEventLoop());
 	}
 	catch (const std::exception& ex)
 	{
 		MessageBoxA(NULL, ex.what(), "Exception", MB_OK | MB_ICONERROR);
 	}
+	TRACE_WRITE("fonted_trace.json");
 	return 0;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "reutils.h"
 #include <regex>
 #include <stdexcept>
+#include <cstring>
 
 namespace reu
 {
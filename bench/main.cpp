@@ -0,0 +1,329 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <fstream>
+#include <sstream>
+
+#include "Font.h"
+#include "FontIO.h"
+#include "FontAtlas.h"
+#include "VirtualCanvas.h"
+#include "MenuFont.h"
+#include "Workspace.h"
+#include "OffscreenWindow.h"
+#include "reutils.h"
+#include "Utils.h"
+
+//Every allocation of the process goes through here, the timed loop reads the counters
+static std::atomic<size_t> s_allocs(0);
+static std::atomic<size_t> s_allocBytes(0);
+
+void* operator new(size_t size)
+{
+	s_allocs.fetch_add(1, std::memory_order_relaxed);
+	s_allocBytes.fetch_add(size, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+	std::free(p);
+}
+
+static volatile unsigned char s_sink;
+
+//Reads the result through a volatile so the optimizer cannot drop the work that produced it
+template<class T>
+static void keep(const T& value)
+{
+	s_sink = *reinterpret_cast<const volatile unsigned char*>(&value);
+}
+
+struct Result
+{
+	std::string	name;
+	size_t		glyphs;
+	size_t		iterations;
+	double		nsPerOp;
+	double		allocsPerOp;
+	double		bytesPerOp;
+	double		taggedAllocs[(int)AllocTag::Count];	//TrackedAllocator allocations per op by subsystem
+};
+
+struct Options
+{
+	std::string			json;
+	std::string			filter;
+	double				minMs = 200.0;
+	std::vector<size_t>	sizes = { 256, 4096, 65536 };
+};
+
+static std::vector<Result> s_results;
+static Options s_opt;
+
+//Runs op in growing batches until a batch takes at least minMs, then reports that batch
+static void run(const std::string& name, size_t glyphs, const std::function<void()>& op)
+{
+	std::string full = glyphs ? name + "/" + std::to_string(glyphs) : name;
+	if (!s_opt.filter.empty() && full.find(s_opt.filter) == std::string::npos)
+		return;
+
+	op();	//Warm up caches and lazy tables
+
+	size_t iterations = 1;
+	for (;;)
+	{
+		size_t allocs = s_allocs.load(), bytes = s_allocBytes.load();
+		AllocCounters tagged[(int)AllocTag::Count];
+		for (int t = 0; t < (int)AllocTag::Count; t++)
+			tagged[t] = AllocStats::Get(AllocTag(t));
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < iterations; i++)
+			op();
+		double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		allocs = s_allocs.load() - allocs;
+		bytes = s_allocBytes.load() - bytes;
+
+		if (ns >= s_opt.minMs * 1e6 || iterations >= (size_t(1) << 30))
+		{
+			Result res = { full, glyphs, iterations, ns / iterations, double(allocs) / iterations, double(bytes) / iterations, {} };
+			for (int t = 0; t < (int)AllocTag::Count; t++)
+				res.taggedAllocs[t] = double(AllocStats::Get(AllocTag(t)).allocs - tagged[t].allocs) / iterations;
+			printf("%-32s %12zu %14.1f %12.1f %14.1f\n", full.c_str(), iterations, res.nsPerOp, res.allocsPerOp, res.bytesPerOp);
+			fflush(stdout);
+			s_results.push_back(res);
+			return;
+		}
+
+		//Aim a bit past the target so the next batch is usually the last one
+		double target = s_opt.minMs * 1e6 * 1.2;
+		size_t next = ns > 0 ? size_t(iterations * target / ns) : iterations * 10;
+		iterations = Max(iterations * 2, Min(next, iterations * 100));
+	}
+}
+
+//8x16 glyphs with a deterministic pattern, fonts over 256 glyphs map code points from U+0100 on, past the surrogates
+static Font makeSyntheticFont(size_t glyphs)
+{
+	const int w = 8, h = 16;
+	std::vector<unsigned char> bits(glyphs * w * h);
+	uint32_t state = 0x12345678;
+	for (auto& px : bits)
+	{
+		state = state * 1664525u + 1013904223u;
+		px = (state >> 28) & 1;
+	}
+
+	std::vector<utf8char_t> seq(glyphs);
+	bool utf8 = glyphs > 256;
+	for (size_t i = 0; i < glyphs; i++)
+	{
+		if (!utf8)
+		{
+			seq[i] = i;
+			continue;
+		}
+		uint32_t cp = uint32_t(i < 128 ? i : i + 0x80);
+		if (cp >= 0xD800)
+			cp += 0x800;
+		seq[i] = codepoint_to_utf8char(cp);
+	}
+
+	return Font::makeFromBits(std::move(bits), h, w, 1, std::move(seq), utf8);
+}
+
+static std::string sampleText(const Font& font, size_t length)
+{
+	std::string text;
+	auto& seq = font.GetSequence();
+	for (size_t i = 0; i < length; i++)
+	{
+		utf8char_t ch = seq[(i * 7919 + 32) % seq.size()];
+		if (ch == '\n' || ch == '\r')
+			ch = 'a';
+		text += font.IsUTF8() ? utf8char_to_stdString(ch) : std::string(1, (char)ch);
+	}
+	return text;
+}
+
+static void benchFont(size_t glyphs)
+{
+	Font font = makeSyntheticFont(glyphs);
+	auto textData = encodeFont(font, FontFormat::Text);
+	auto packedData = encodeFont(font, FontFormat::Packed);
+	std::string textFont(textData.begin(), textData.end());
+	auto& seq = font.GetSequence();
+
+#ifdef NDEBUG
+	run("font_load_text", glyphs, [&]() { keep(Font::makeFromText(textFont)); });
+#else
+	//Unoptimized text parsing of the largest fonts takes close to a minute per op
+	if (glyphs <= 4096)
+		run("font_load_text", glyphs, [&]() { keep(Font::makeFromText(textFont)); });
+#endif
+	run("font_load_packed", glyphs, [&]() { keep(decodeFont(packedData)); });
+
+	size_t k = 0;
+	run("glyph_monospace", glyphs, [&]() { keep(font.GetCharImage_8bit(seq[(k += 7919) % seq.size()], true)); });
+	run("glyph_proportional", glyphs, [&]() { keep(font.GetCharImage_8bit(seq[(k += 7919) % seq.size()], false)); });
+	run("font_table", glyphs, [&]() { keep(font.getFontTable(64)); });
+	run("atlas_build", glyphs, [&]() { keep(buildFontAtlas(font, AtlasOptions())); });
+
+	std::string line = sampleText(font, 64);
+	VirtualCanvas canvas(64 * 9, 32);
+	run("draw_text", glyphs, [&]() { canvas.Clear(); keep(canvas.DrawTextRegular(font, line, 0, 0)); });
+
+	//What Canvas::_draw does per frame: drain edits, redraw the menu bar, workspace with overlay.
+	//Glyph images of the menu text come from the frame arena, a steady frame should not allocate.
+	bitmap_t table = font.getFontTable(64);
+	int tw = (int)table[0].size(), th = (int)table.size();
+	const int menuHeight = 16;
+	Workspace workspace;
+	workspace.Load(table, font.GetHeight(), font.GetWidth(), (int)glyphs);
+	VirtualCanvas menu(tw, menuHeight);
+	std::string menuText = sampleText(font, 16);
+	FrameArena arena;
+	ArenaBinding arenaBinding(arena);
+	OffscreenWindow window(tw, th + menuHeight);
+	SpscQueue<EditCommand> edits;
+	int frame = 0;
+	run("frame_compose", glyphs, [&]()
+	{
+		int x = frame++ % tw;
+		arena.Reset();
+		menu.Clear();
+		menu.DrawTextRegular(font, menuText, 2, 0);
+		edits.Push({ EditOp::Line, x, 1, x + 5, 9, false });
+		window.beginFrame();
+		workspace.ApplyAll(edits);
+		menu.Present(window, [](pixel_t px) { return px ? 0xFFFFFFFFu : 0xFF000044u; });
+		workspace.Present(window, { x, 4, true, true, false, 0, 0, 0xFFFFFF00 }, 1, menuHeight);
+		window.endFrame();
+	});
+}
+
+static void benchShared()
+{
+	bitmap_t bmp;
+	InitBitmap(bmp, 128, 256);
+	run("upscale_x4", 0, [&]() { bitmap_t copy = bmp; bmpUpscaleLinear(copy, 4); keep(copy); });
+
+	std::string text;
+	for (int i = 0; i < 1024; i++)
+		text += i % 3 == 0 ? "a" : (i % 3 == 1 ? "\xD0\x96" : "\xE2\x82\xAC");
+	run("utf8_enumerate", 0, [&]()
+	{
+		size_t sum = 0;
+		enumerateUTF8String(text, [&](utf8char_t ch, size_t, size_t) { sum += ch; });
+		keep(sum);
+	});
+
+	//Header lines of a font file, the patterns Font uses while loading
+	std::string dims = "8x16", interval = "i1";
+	run("reu_search", 0, [&]()
+	{
+		keep(reu::Search(dims, "^([0-9]+)x([0-9]+)$"));
+		keep(reu::Search(interval, "^i([0-9]{1,2})$"));
+	});
+
+	//The menu and stats overlay font, drawn from constant bits
+	std::string menuLine = "New Open Save [123|45] fps 60.0 frame 16.6ms alloc 0/0B";
+	VirtualCanvas menu(64 * 9, 16);
+	run("draw_text_static", 0, [&]() { menu.Clear(); keep(menu.DrawTextRegular(s_menuFont, menuLine, 0, 1)); });
+}
+
+static void writeJson(const std::string& path)
+{
+	std::stringstream ss;
+	ss << "{\n\t\"min_ms\": " << s_opt.minMs << ",\n\t\"benchmarks\": [";
+	for (size_t i = 0; i < s_results.size(); i++)
+	{
+		auto& r = s_results[i];
+		ss << (i == 0 ? "\n" : ",\n") << "\t\t{ \"name\": \"" << r.name << "\", \"glyphs\": " << r.glyphs
+			<< ", \"iterations\": " << r.iterations << ", \"ns_per_op\": " << r.nsPerOp
+			<< ", \"allocs_per_op\": " << r.allocsPerOp << ", \"bytes_per_op\": " << r.bytesPerOp << ", \"tracked_allocs_per_op\": {";
+		for (int t = 0, n = 0; t < (int)AllocTag::Count; t++)
+		{
+			if (r.taggedAllocs[t] > 0)
+				ss << (n++ ? ", " : " ") << "\"" << AllocStats::TagName(AllocTag(t)) << "\": " << r.taggedAllocs[t];
+		}
+		ss << " } }";
+	}
+	ss << "\n\t]\n}\n";
+
+	std::ofstream out(path, std::ios::binary);
+	if (!out || !(out << ss.str()))
+		throw std::runtime_error("Failed to write " + path);
+}
+
+static bool parseArgs(int argc, char** argv)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (i + 1 >= argc)
+			return false;
+
+		if (arg == "--json")
+			s_opt.json = argv[++i];
+		else if (arg == "--filter")
+			s_opt.filter = argv[++i];
+		else if (arg == "--min-ms")
+			s_opt.minMs = std::atof(argv[++i]);
+		else if (arg == "--sizes")
+		{
+			s_opt.sizes.clear();
+			std::stringstream ss(argv[++i]);
+			std::string item;
+			while (std::getline(ss, item, ','))
+				s_opt.sizes.push_back((size_t)std::strtoul(item.c_str(), nullptr, 10));
+		}
+		else
+			return false;
+	}
+	return s_opt.minMs > 0;
+}
+
+int main(int argc, char** argv)
+{
+	if (!parseArgs(argc, argv))
+	{
+		fprintf(stderr,
+			"usage: fonted_bench [--json <file>] [--filter <substring>] [--min-ms <ms>] [--sizes 256,4096,65536]\n");
+		return 2;
+	}
+
+	try
+	{
+		printf("%-32s %12s %14s %12s %14s\n", "benchmark", "iterations", "ns/op", "allocs/op", "bytes/op");
+		benchShared();
+		for (auto glyphs : s_opt.sizes)
+		{
+			if (glyphs == 0 || glyphs > 65536)
+				throw std::runtime_error("Glyph counts must be in 1..65536");
+			benchFont(glyphs);
+		}
+
+		if (!s_opt.json.empty())
+			writeJson(s_opt.json);
+		return 0;
+	}
+	catch (const std::exception& ex)
+	{
+		fprintf(stderr, "error: %s\n", ex.what());
+		return 1;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <chrono>
+#include <stdexcept>
+#include <filesystem>
+
+#include "Font.h"
+#include "FontIO.h"
+#include "FontAtlas.h"
+#include "ImageWriter.h"
+#include "FileWriter.h"
+
+namespace fs = std::filesystem;
+
+struct Options
+{
+	std::string		input;
+	std::string		output;
+	std::string		face;
+	ImageFormat		format = ImageFormat::PNG;
+	AtlasOptions	atlas;
+	bool			binary = false;
+};
+
+static void usage()
+{
+	fprintf(stderr,
+		"usage: fonted_atlas [options] <font>\n"
+		"  -o <path>       output path without extension (default: <font>_atlas next to the font)\n"
+		"  -t <fmt>        atlas image format: png, pbm or ppm (default png)\n"
+		"  -n <name>       face name in the metrics (default: the font file name)\n"
+		"  -p <n>          padding around every glyph (default 0)\n"
+		"  -s <n>          spacing between glyphs (default 1)\n"
+		"  -m              monospace metrics, glyphs advance by the full cell\n"
+		"  -b              binary BMFont metrics instead of text\n"
+		"Writes <path>.png and <path>.fnt, glyphs are white on black.\n");
+}
+
+static bool parseArgs(int argc, char** argv, Options& opt)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "-m")
+			opt.atlas.monospace = true;
+		else if (arg == "-b")
+			opt.binary = true;
+		else if (arg == "-o" && hasValue)
+			opt.output = argv[++i];
+		else if (arg == "-n" && hasValue)
+			opt.face = argv[++i];
+		else if (arg == "-t" && hasValue)
+		{
+			if (!imageFormatFromName(argv[++i], opt.format) || opt.format == ImageFormat::Raw)
+				return false;
+		}
+		else if (arg == "-p" && hasValue)
+			opt.atlas.padding = std::atoi(argv[++i]);
+		else if (arg == "-s" && hasValue)
+			opt.atlas.spacing = std::atoi(argv[++i]);
+		else if (arg[0] != '-' && opt.input.empty())
+			opt.input = arg;
+		else
+			return false;
+	}
+	return !opt.input.empty();
+}
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	if (!parseArgs(argc, argv, opt))
+	{
+		usage();
+		return 2;
+	}
+
+	fs::path input(opt.input);
+	if (opt.output.empty())
+		opt.output = (input.parent_path() / (input.stem().string() + "_atlas")).string();
+	if (opt.face.empty())
+		opt.face = input.stem().string();
+
+	try
+	{
+		auto start = std::chrono::steady_clock::now();
+		Font font = loadFont(opt.input);
+		FontAtlas atlas = buildFontAtlas(font, opt.atlas);
+
+		fs::path image = opt.output + imageFormatExtension(opt.format);
+		fs::path metrics = opt.output + ".fnt";
+		//BMFont metrics share the extension of the editor format
+		if (fs::exists(metrics) && fs::equivalent(metrics, input))
+			throw std::runtime_error("Metrics would overwrite the input");
+
+		writeImage(image.string(), atlas.image, opt.format, true);
+		FileWriter out(metrics.string());
+		if (opt.binary)
+			writeBMFontBinary(out, atlas, opt.face, image.filename().string());
+		else
+			writeBMFontText(out, atlas, opt.face, image.filename().string());
+		out.Close();
+
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		printf("%s: %zu glyphs, %zux%zu atlas, %.1f ms\n", metrics.string().c_str(), atlas.glyphs.size(),
+			atlas.image.empty() ? 0 : atlas.image[0].size(), atlas.image.size(), ms);
+		return 0;
+	}
+	catch (const std::exception& ex)
+	{
+		fprintf(stderr, "error: %s\n", ex.what());
+		return 1;
+	}
+}
\ No newline at end of file
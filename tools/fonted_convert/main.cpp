@@ -0,0 +1,323 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <set>
+#include <map>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <filesystem>
+
+#include "Font.h"
+#include "FontIO.h"
+#include "BdfFont.h"
+#include "Parallel.h"
+
+namespace fs = std::filesystem;
+
+struct Options
+{
+	std::vector<std::string>	inputs;
+	std::string					outDir;
+	std::string					report;
+	FontFormat					format = FontFormat::Text;
+	bool						convert = false;
+	bool						recursive = false;
+	unsigned					threads = 0;
+};
+
+struct Result
+{
+	std::string					path;
+	fs::path					relative;	//Under -o: the path below the scanned directory, or the file name
+	fs::path					target;
+	std::string					output;
+	std::string					error;
+	std::vector<std::string>	warnings;
+	const char*					format = "";
+	int							width = 0;
+	int							height = 0;
+	int							interval = 0;
+	size_t						glyphs = 0;
+	bool						utf8 = false;
+	double						ms = 0.0;
+};
+
+static void usage()
+{
+	fprintf(stderr,
+		"usage: fonted_convert [options] <font or directory>...\n"
+		"  -t <fmt>        convert every valid font to fnt (text), fntb (packed), psf/psf2, psf1 or bdf\n"
+		"  -o <dir>        output directory for converted fonts, subdirectories of scanned directories are kept (default: next to the input)\n"
+		"  -r <file>       write the JSON report to a file instead of stdout\n"
+		"  -j <n>          worker threads, 0 = one per core (default 0)\n"
+		"  -R              descend into subdirectories\n"
+		"Without -t fonts are only validated. Directories are scanned for *.fnt, *.txt, *.fntb, *.psf and *.bdf.\n");
+}
+
+static bool parseArgs(int argc, char** argv, Options& opt)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "-R")
+			opt.recursive = true;
+		else if (arg == "-t" && hasValue)
+		{
+			if (!fontFormatFromName(argv[++i], opt.format))
+				return false;
+			opt.convert = true;
+		}
+		else if (arg == "-o" && hasValue)
+			opt.outDir = argv[++i];
+		else if (arg == "-r" && hasValue)
+			opt.report = argv[++i];
+		else if (arg == "-j" && hasValue)
+			opt.threads = (unsigned)std::atoi(argv[++i]);
+		else if (arg[0] != '-')
+			opt.inputs.push_back(arg);
+		else
+			return false;
+	}
+	return !opt.inputs.empty();
+}
+
+static bool isFontFile(const fs::path& path)
+{
+	auto ext = path.extension().string();
+	return ext == ".fnt" || ext == ".fntb" || ext == ".txt" || ext == ".psf" || ext == ".bdf";
+}
+
+static std::vector<Result> collectFonts(const Options& opt)
+{
+	std::vector<Result> files;
+	for (auto& input : opt.inputs)
+	{
+		if (!fs::is_directory(input))
+		{
+			files.push_back({ input, fs::path(input).filename() });
+			continue;
+		}
+
+		std::vector<Result> found;
+		auto add = [&](const fs::directory_entry& entry)
+		{
+			if (entry.is_regular_file() && isFontFile(entry.path()))
+				found.push_back({ entry.path().string(), entry.path().lexically_relative(input) });
+		};
+		if (opt.recursive)
+		{
+			for (auto& entry : fs::recursive_directory_iterator(input))
+				add(entry);
+		}
+		else
+		{
+			for (auto& entry : fs::directory_iterator(input))
+				add(entry);
+		}
+
+		//Directory order is arbitrary, keep reports stable between runs
+		std::sort(found.begin(), found.end(), [](const Result& a, const Result& b) { return a.path < b.path; });
+		files.insert(files.end(), found.begin(), found.end());
+	}
+	return files;
+}
+
+//Problems that do not stop the font from loading but will bite later
+static void checkFont(const Font& font, Result& res)
+{
+	auto& seq = font.GetSequence();
+	std::set<utf8char_t> seen;
+	size_t duplicates = 0;
+	for (auto ch : seq)
+	{
+		if (!seen.insert(ch).second)
+			duplicates++;
+	}
+	if (duplicates > 0)
+		res.warnings.push_back(std::to_string(duplicates) + " duplicate codes in the sequence, later glyphs are unreachable");
+
+	if (!seq.empty() && seen.count('?') == 0)
+		res.warnings.push_back("no '?' glyph, unsupported characters render as nothing");
+
+	size_t glyphBits = size_t(font.GetWidth()) * font.GetHeight();
+	auto& bits = font.GetBits();
+	size_t blank = 0;
+	for (size_t g = 0; g < res.glyphs; g++)
+	{
+		bool empty = true;
+		for (size_t i = 0; i < glyphBits && empty; i++)
+			empty = bits[g * glyphBits + i] == 0;
+		if (empty)
+			blank++;
+	}
+	if (blank == res.glyphs)
+		res.warnings.push_back("all glyphs are blank");
+}
+
+static void processFont(const Options& opt, Result& res)
+{
+	auto start = std::chrono::steady_clock::now();
+	try
+	{
+		//BDF streams from the file, the other formats are decoded from memory
+		bool bdf = isBdfFile(res.path);
+		std::vector<unsigned char> data;
+		if (!bdf)
+			data = readFile(res.path);
+		res.format = bdf ? "bdf" : fontFormatName(detectFontFormat(data));
+		Font font = bdf ? readBdf(res.path) : decodeFont(data);
+		res.width = font.GetWidth();
+		res.height = font.GetHeight();
+		res.interval = font.GetInterval();
+		res.glyphs = font.GetBits().size() / (size_t(res.width) * res.height);
+		res.utf8 = font.IsUTF8();
+		checkFont(font, res);
+
+		if (opt.convert)
+		{
+			const fs::path& out = res.target;
+			if (fs::exists(out) && fs::equivalent(out, res.path))
+				throw std::runtime_error("Conversion would overwrite the input");
+
+			if (!opt.outDir.empty())
+				fs::create_directories(out.parent_path());
+			saveFont(out.string(), font, opt.format);
+			res.output = out.string();
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		res.error = ex.what();
+	}
+	res.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::string jsonString(const std::string& str)
+{
+	std::string out = "\"";
+	for (unsigned char c : str)
+	{
+		switch (c)
+		{
+		case '"':	out += "\\\""; break;
+		case '\\':	out += "\\\\"; break;
+		case '\n':	out += "\\n"; break;
+		case '\r':	out += "\\r"; break;
+		case '\t':	out += "\\t"; break;
+		default:
+			if (c < 0x20)
+			{
+				char buf[8];
+				snprintf(buf, sizeof(buf), "\\u%04x", c);
+				out += buf;
+			}
+			else
+				out.push_back((char)c);
+		}
+	}
+	return out + "\"";
+}
+
+static std::string makeReport(const std::vector<Result>& results, unsigned threads, double ms)
+{
+	size_t failed = 0;
+	for (auto& res : results)
+		failed += res.error.empty() ? 0 : 1;
+
+	std::stringstream ss;
+	ss << "{\n\t\"files\": " << results.size() << ",\n\t\"valid\": " << results.size() - failed
+		<< ",\n\t\"invalid\": " << failed << ",\n\t\"threads\": " << threads << ",\n\t\"ms\": " << ms << ",\n\t\"fonts\": [";
+
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		auto& res = results[i];
+		ss << (i == 0 ? "\n" : ",\n") << "\t\t{ \"path\": " << jsonString(res.path) << ", \"ok\": " << (res.error.empty() ? "true" : "false");
+		if (res.format[0])
+			ss << ", \"format\": \"" << res.format << "\"";
+		if (!res.error.empty())
+			ss << ", \"error\": " << jsonString(res.error);
+		else
+		{
+			ss << ", \"width\": " << res.width << ", \"height\": " << res.height << ", \"interval\": " << res.interval
+				<< ", \"glyphs\": " << res.glyphs << ", \"utf8\": " << (res.utf8 ? "true" : "false");
+		}
+		if (!res.output.empty())
+			ss << ", \"output\": " << jsonString(res.output);
+
+		ss << ", \"warnings\": [";
+		for (size_t w = 0; w < res.warnings.size(); w++)
+			ss << (w == 0 ? "" : ", ") << jsonString(res.warnings[w]);
+		ss << "], \"ms\": " << res.ms << " }";
+	}
+	ss << (results.empty() ? "]\n}\n" : "\n\t]\n}\n");
+	return ss.str();
+}
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	if (!parseArgs(argc, argv, opt))
+	{
+		usage();
+		return 2;
+	}
+
+	try
+	{
+		auto start = std::chrono::steady_clock::now();
+		if (!opt.outDir.empty())
+			fs::create_directories(opt.outDir);
+
+		std::vector<Result> results = collectFonts(opt);
+
+		//Two inputs writing one output would race between workers, only the first one converts
+		std::map<std::string, std::string> targets;
+		for (auto& res : results)
+		{
+			if (!opt.convert)
+				break;
+
+			res.target = opt.outDir.empty() ? fs::path(res.path) : fs::path(opt.outDir) / res.relative;
+			res.target.replace_extension(fontFormatExtension(opt.format));
+			auto slot = targets.emplace(fs::absolute(res.target).lexically_normal().string(), res.path);
+			if (!slot.second)
+				res.error = "Output " + res.target.string() + " is already written for " + slot.first->second;
+		}
+
+		//Each font is read, parsed and written by one worker, nothing is shared between them
+		unsigned threads = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+		parallelFor(results.size(), threads, [&](size_t i)
+		{
+			if (results[i].error.empty())
+				processFont(opt, results[i]);
+		});
+
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::string report = makeReport(results, threads, ms);
+		if (opt.report.empty())
+			fputs(report.c_str(), stdout);
+		else
+		{
+			std::ofstream out(opt.report, std::ios::binary);
+			if (!out || !(out << report))
+				throw std::runtime_error("Failed to write " + opt.report);
+		}
+
+		for (auto& res : results)
+		{
+			if (!res.error.empty())
+				return 1;
+		}
+		return 0;
+	}
+	catch (const std::exception& ex)
+	{
+		fprintf(stderr, "error: %s\n", ex.what());
+		return 1;
+	}
+}
\ No newline at end of file
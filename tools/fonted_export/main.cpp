@@ -0,0 +1,79 @@
+#include <cstdio>
+#include <string>
+#include <stdexcept>
+#include <filesystem>
+
+#include "Font.h"
+#include "FontIO.h"
+#include "FileWriter.h"
+#include "SourceExporter.h"
+
+namespace fs = std::filesystem;
+
+struct Options
+{
+	std::string	input;
+	std::string	output;
+	std::string	name;
+};
+
+static void usage()
+{
+	fprintf(stderr,
+		"usage: fonted_export [options] <font>\n"
+		"  -o <file>   output header (default: the font path with .h)\n"
+		"  -n <name>   name of the EmbeddedFont in the header (default: from the file name)\n"
+		"Writes the font as constexpr tables for EmbeddedFont.h.\n");
+}
+
+static bool parseArgs(int argc, char** argv, Options& opt)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "-o" && hasValue)
+			opt.output = argv[++i];
+		else if (arg == "-n" && hasValue)
+			opt.name = argv[++i];
+		else if (arg[0] != '-' && opt.input.empty())
+			opt.input = arg;
+		else
+			return false;
+	}
+	return !opt.input.empty();
+}
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	if (!parseArgs(argc, argv, opt))
+	{
+		usage();
+		return 2;
+	}
+
+	if (opt.name.empty())
+		opt.name = sourceIdentifierFromPath(opt.input);
+	if (!isSourceIdentifier(opt.name))
+	{
+		fprintf(stderr, "error: '%s' is not a valid C++ identifier\n", opt.name.c_str());
+		return 2;
+	}
+	if (opt.output.empty())
+		opt.output = fs::path(opt.input).replace_extension(".h").string();
+
+	try
+	{
+		Font font = loadFont(opt.input);
+		FileWriter out(opt.output);
+		writeFontSource(out, font, opt.name, fs::path(opt.input).filename().string());
+		out.Close();
+		return 0;
+	}
+	catch (const std::exception& ex)
+	{
+		fprintf(stderr, "error: %s\n", ex.what());
+		return 1;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,363 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <set>
+#include <fstream>
+#include <iostream>
+#include <chrono>
+#include <stdexcept>
+
+#include "Font.h"
+#include "VirtualCanvas.h"
+#include "ImageWriter.h"
+#include "Parallel.h"
+
+struct Options
+{
+	std::string	font;
+	std::string	outDir = ".";
+	std::string	jobFile;
+	ImageFormat	format = ImageFormat::PNG;
+	unsigned	threads = 0;
+	int			scale = 1;
+	int			padding = 0;
+	bool		monospace = false;
+	bool		invert = false;
+};
+
+struct Job
+{
+	std::string	name;
+	std::string	text;
+	std::string	error;
+	int			width = 0;
+	int			height = 0;
+};
+
+static void usage()
+{
+	fprintf(stderr,
+		"usage: fonted_render -f <font> [options] [job file]\n"
+		"  -f <font>          font in the editor text format\n"
+		"  -o <dir>           output directory (default .)\n"
+		"  -t <fmt>           output format: png, pbm, ppm or raw (default png)\n"
+		"  -j <n>             worker threads, 0 = one per core (default 0)\n"
+		"  -s <n>             integer scale (default 1)\n"
+		"  -p <n>             padding around the text in pixels (default 0)\n"
+		"  -m                 monospace layout\n"
+		"  -i                 invert glyph cells\n"
+		"Without a job file every stdin line is one job, images are named by line number.\n"
+		"Job files: *.tsv has \"name<TAB>text\" lines, text understands \\n \\t \\\\ escapes;\n"
+		"*.json / *.jsonl has one {\"name\": \"...\", \"text\": \"...\"} object per line.\n");
+}
+
+static std::string unescapeTsv(const std::string& str)
+{
+	std::string out;
+	for (size_t i = 0; i < str.length(); i++)
+	{
+		if (str[i] != '\\' || i + 1 == str.length())
+		{
+			out.push_back(str[i]);
+			continue;
+		}
+
+		switch (str[++i])
+		{
+		case 'n':	out.push_back('\n'); break;
+		case 't':	out.push_back('\t'); break;
+		default:	out.push_back(str[i]); break;
+		}
+	}
+	return out;
+}
+
+static void appendUtf8(std::string& out, unsigned long cp)
+{
+	if (cp < 0x80)
+		out.push_back((char)cp);
+	else if (cp < 0x800)
+	{
+		out.push_back((char)(0xC0 | (cp >> 6)));
+		out.push_back((char)(0x80 | (cp & 0x3F)));
+	}
+	else if (cp < 0x10000)
+	{
+		out.push_back((char)(0xE0 | (cp >> 12)));
+		out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+		out.push_back((char)(0x80 | (cp & 0x3F)));
+	}
+	else
+	{
+		out.push_back((char)(0xF0 | (cp >> 18)));
+		out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+		out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+		out.push_back((char)(0x80 | (cp & 0x3F)));
+	}
+}
+
+//Flat JSON object with string values only, enough for job lines
+static bool parseJsonLine(const std::string& line, std::string& name, std::string& text)
+{
+	size_t i = 0;
+	auto skip = [&]() { while (i < line.length() && isspace((unsigned char)line[i])) i++; };
+	auto str = [&](std::string& out) -> bool
+	{
+		skip();
+		if (i >= line.length() || line[i] != '"')
+			return false;
+
+		out.clear();
+		for (i++; i < line.length(); i++)
+		{
+			char c = line[i];
+			if (c == '"')
+			{
+				i++;
+				return true;
+			}
+			if (c != '\\')
+			{
+				out.push_back(c);
+				continue;
+			}
+			if (++i >= line.length())
+				return false;
+
+			switch (line[i])
+			{
+			case 'n':	out.push_back('\n'); break;
+			case 't':	out.push_back('\t'); break;
+			case 'r':	out.push_back('\r'); break;
+			case 'b':	out.push_back('\b'); break;
+			case 'f':	out.push_back('\f'); break;
+			case 'u':
+			{
+				if (i + 4 >= line.length())
+					return false;
+				unsigned long cp = std::strtoul(line.substr(i + 1, 4).c_str(), nullptr, 16);
+				i += 4;
+				if (cp >= 0xD800 && cp < 0xDC00 && i + 6 < line.length() && line[i + 1] == '\\' && line[i + 2] == 'u')
+				{
+					unsigned long lo = std::strtoul(line.substr(i + 3, 4).c_str(), nullptr, 16);
+					cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+					i += 6;
+				}
+				appendUtf8(out, cp);
+				break;
+			}
+			default:	out.push_back(line[i]); break;
+			}
+		}
+		return false;
+	};
+
+	skip();
+	if (i >= line.length() || line[i++] != '{')
+		return false;
+
+	bool hasText = false;
+	for (;;)
+	{
+		std::string key, value;
+		if (!str(key))
+			return false;
+		skip();
+		if (i >= line.length() || line[i++] != ':')
+			return false;
+		if (!str(value))
+			return false;
+
+		if (key == "name")
+			name = value;
+		else if (key == "text")
+		{
+			text = value;
+			hasText = true;
+		}
+
+		skip();
+		if (i < line.length() && line[i] == ',')
+		{
+			i++;
+			continue;
+		}
+		return hasText && i < line.length() && line[i] == '}';
+	}
+}
+
+static bool endsWith(const std::string& str, const std::string& suffix)
+{
+	return str.length() >= suffix.length() && str.compare(str.length() - suffix.length(), suffix.length(), suffix) == 0;
+}
+
+static std::vector<Job> readJobs(std::istream& in, const std::string& kind)
+{
+	std::vector<Job> jobs;
+	std::string line;
+	size_t lineNo = 0;
+	while (std::getline(in, line))
+	{
+		lineNo++;
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+
+		Job job;
+		job.name = std::to_string(lineNo);
+		if (kind == "json")
+		{
+			if (line.find_first_not_of(" \t") == std::string::npos)
+				continue;
+			if (!parseJsonLine(line, job.name, job.text))
+				throw std::runtime_error("Invalid job at line " + std::to_string(lineNo));
+		}
+		else if (kind == "tsv")
+		{
+			size_t tab = line.find('\t');
+			if (tab == std::string::npos)
+				throw std::runtime_error("Missing tab at line " + std::to_string(lineNo));
+			job.name = line.substr(0, tab);
+			job.text = unescapeTsv(line.substr(tab + 1));
+		}
+		else
+			job.text = line;
+
+		jobs.push_back(job);
+	}
+	return jobs;
+}
+
+//Job names become file names inside the output directory, nothing that could point elsewhere
+static bool isPlainFileName(const std::string& name)
+{
+	return !name.empty() && name != "." && name != ".." && name.find_first_of("/\\:") == std::string::npos;
+}
+
+static bitmap_t render(const Font& font, const std::string& text, const Options& opt)
+{
+	auto dims = VirtualCanvas::MeasureText(font, text, opt.monospace);
+	VirtualCanvas canvas(Max(dims.b_x, 1) + opt.padding * 2, dims.b_y + opt.padding * 2);
+	canvas.DrawTextRegular(font, text, opt.padding, opt.padding, 1, opt.invert, opt.monospace);
+
+	bitmap_t bmp = canvas.GetBitmap();
+	bmpUpscaleLinear(bmp, opt.scale);
+	return bmp;
+}
+
+static bool parseArgs(int argc, char** argv, Options& opt)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "-m")
+			opt.monospace = true;
+		else if (arg == "-i")
+			opt.invert = true;
+		else if (arg == "-f" && hasValue)
+			opt.font = argv[++i];
+		else if (arg == "-o" && hasValue)
+			opt.outDir = argv[++i];
+		else if (arg == "-t" && hasValue)
+		{
+			if (!imageFormatFromName(argv[++i], opt.format))
+				return false;
+		}
+		else if (arg == "-j" && hasValue)
+			opt.threads = (unsigned)std::atoi(argv[++i]);
+		else if (arg == "-s" && hasValue)
+			opt.scale = std::atoi(argv[++i]);
+		else if (arg == "-p" && hasValue)
+			opt.padding = std::atoi(argv[++i]);
+		else if (arg[0] != '-' && opt.jobFile.empty())
+			opt.jobFile = arg;
+		else
+			return false;
+	}
+	return !opt.font.empty() && opt.scale > 0 && opt.padding >= 0;
+}
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	if (!parseArgs(argc, argv, opt))
+	{
+		usage();
+		return 2;
+	}
+
+	try
+	{
+		auto start = std::chrono::steady_clock::now();
+		Font font(opt.font);
+
+		std::vector<Job> jobs;
+		if (opt.jobFile.empty())
+			jobs = readJobs(std::cin, "lines");
+		else
+		{
+			std::ifstream in(opt.jobFile, std::ios::binary);
+			if (!in)
+				throw std::runtime_error("Failed to open " + opt.jobFile);
+			std::string kind = endsWith(opt.jobFile, ".tsv") ? "tsv" : (endsWith(opt.jobFile, ".json") || endsWith(opt.jobFile, ".jsonl") ? "json" : "lines");
+			jobs = readJobs(in, kind);
+		}
+
+		//The font is only read while rendering, all workers share it
+		const char* ext = imageFormatExtension(opt.format);
+		std::set<std::string> names;
+		for (auto& job : jobs)
+		{
+			std::string file = endsWith(job.name, ext) ? job.name : job.name + ext;
+			if (!isPlainFileName(job.name))
+				job.error = "Job name must be a plain file name";
+			else if (!names.insert(file).second)
+				job.error = "Duplicate job name";
+		}
+
+		parallelFor(jobs.size(), opt.threads, [&](size_t i)
+		{
+			Job& job = jobs[i];
+			if (!job.error.empty())
+				return;
+			try
+			{
+				bitmap_t bmp = render(font, job.text, opt);
+				job.height = (int)bmp.size();
+				job.width = bmp.empty() ? 0 : (int)bmp[0].size();
+
+				std::string path = opt.outDir + "/" + job.name;
+				if (!endsWith(path, ext))
+					path += ext;
+				writeImage(path, bmp, opt.format);
+			}
+			catch (const std::exception& ex)
+			{
+				job.error = ex.what();
+			}
+		});
+
+		size_t failed = 0;
+		for (auto& job : jobs)
+		{
+			if (job.error.empty())
+				printf("%s\t%dx%d\n", job.name.c_str(), job.width, job.height);
+			else
+			{
+				fprintf(stderr, "%s: %s\n", job.name.c_str(), job.error.c_str());
+				failed++;
+			}
+		}
+
+		auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+		fprintf(stderr, "rendered %zu of %zu jobs in %lld ms\n", jobs.size() - failed, jobs.size(), (long long)ms);
+		return failed == 0 ? 0 : 1;
+	}
+	catch (const std::exception& ex)
+	{
+		fprintf(stderr, "error: %s\n", ex.what());
+		return 1;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <chrono>
+#include <stdexcept>
+#include <filesystem>
+
+#include "Font.h"
+#include "FontIO.h"
+#include "SheetImporter.h"
+
+namespace fs = std::filesystem;
+
+struct Options
+{
+	std::string		input;
+	std::string		output;
+	FontFormat		format = FontFormat::Text;
+	SheetOptions	sheet;
+};
+
+static void usage()
+{
+	fprintf(stderr,
+		"usage: fonted_sheet -w <n> -h <n> [options] <image>\n"
+		"  -w <n>          cell width\n"
+		"  -h <n>          cell height\n"
+		"  -s <seq>        codes of the cells in font file notation, e.g. \"32-127\" (default: every cell, 0..n-1)\n"
+		"  -T <n>          gray level below which a pixel is ink (default 128)\n"
+		"  -i              light ink on a dark sheet\n"
+		"  -n <n>          interval of the font (default 0)\n"
+		"  -t <fmt>        output format: fnt (text), fntb (packed), psf/psf2, psf1 or bdf (default fnt)\n"
+		"  -o <path>       output font (default: the image name with the format's extension)\n"
+		"Reads PBM, PGM and BMP sheets laid out like the editor's font table: cells separated by 1px lines, no border.\n");
+}
+
+static bool parseArgs(int argc, char** argv, Options& opt)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "-i")
+			opt.sheet.invert = true;
+		else if (arg == "-w" && hasValue)
+			opt.sheet.cellW = std::atoi(argv[++i]);
+		else if (arg == "-h" && hasValue)
+			opt.sheet.cellH = std::atoi(argv[++i]);
+		else if (arg == "-s" && hasValue)
+			opt.sheet.sequence = argv[++i];
+		else if (arg == "-T" && hasValue)
+			opt.sheet.threshold = std::atoi(argv[++i]);
+		else if (arg == "-n" && hasValue)
+			opt.sheet.interval = std::atoi(argv[++i]);
+		else if (arg == "-t" && hasValue)
+		{
+			if (!fontFormatFromName(argv[++i], opt.format))
+				return false;
+		}
+		else if (arg == "-o" && hasValue)
+			opt.output = argv[++i];
+		else if (arg[0] != '-' && opt.input.empty())
+			opt.input = arg;
+		else
+			return false;
+	}
+	return !opt.input.empty() && opt.sheet.cellW > 0 && opt.sheet.cellH > 0;
+}
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	if (!parseArgs(argc, argv, opt))
+	{
+		usage();
+		return 2;
+	}
+
+	if (opt.output.empty())
+		opt.output = fs::path(opt.input).replace_extension(fontFormatExtension(opt.format)).string();
+
+	try
+	{
+		auto start = std::chrono::steady_clock::now();
+		Font font = importSheet(opt.input, opt.sheet);
+		saveFont(opt.output, font, opt.format);
+
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		size_t glyphs = font.GetBits().size() / (font.GetWidth() * font.GetHeight());
+		printf("%s: %zu glyphs %dx%d, %.1f ms\n", opt.output.c_str(), glyphs, font.GetWidth(), font.GetHeight(), ms);
+		return 0;
+	}
+	catch (const std::exception& ex)
+	{
+		fprintf(stderr, "error: %s\n", ex.what());
+		return 1;
+	}
+}
\ No newline at end of file
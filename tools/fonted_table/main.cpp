@@ -0,0 +1,136 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <algorithm>
+#include <sstream>
+#include <chrono>
+#include <stdexcept>
+#include <filesystem>
+
+#include "Font.h"
+#include "FontIO.h"
+#include "FontTableImage.h"
+#include "ImageWriter.h"
+#include "FileWriter.h"
+
+namespace fs = std::filesystem;
+
+struct Options
+{
+	std::string			input;
+	std::string			output;
+	ImageFormat			format = ImageFormat::PNG;
+	bool				formatSet = false;	//-t given, otherwise the format follows the output extension
+	TableImageOptions	table;
+};
+
+static void usage()
+{
+	fprintf(stderr,
+		"usage: fonted_table [options] <font>\n"
+		"  -o <path>       output picture (default: <font>_table next to the font)\n"
+		"  -t <png|ppm>    picture format (default: from the -o extension, png otherwise)\n"
+		"  -c <n>          cells per row (default 16)\n"
+		"  -s <n>          glyph scale (default 1)\n"
+		"  -L              no code labels under the glyphs\n"
+		"  -p <colors>     palette as ink,paper,grid,empty,label hex RGB (default 000000,FFFFFF,808080,C0C0C0,3050A0)\n"
+		"Writes the editor's font table grid, labels show code points of UTF-8 fonts and byte values otherwise.\n");
+}
+
+static bool parsePalette(const std::string& str, TableImageOptions& table)
+{
+	uint32_t* colors[] = { &table.ink, &table.paper, &table.grid, &table.empty, &table.label };
+	std::stringstream ss(str);
+	std::string item;
+	size_t i = 0;
+	while (std::getline(ss, item, ','))
+	{
+		char* end = nullptr;
+		unsigned long v = std::strtoul(item.c_str(), &end, 16);
+		if (i == 5 || item.empty() || *end || v > 0xFFFFFF)
+			return false;
+		*colors[i++] = (uint32_t)v;
+	}
+	return i == 5;
+}
+
+static bool parseArgs(int argc, char** argv, Options& opt)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "-L")
+			opt.table.labels = false;
+		else if (arg == "-o" && hasValue)
+			opt.output = argv[++i];
+		else if (arg == "-t" && hasValue)
+		{
+			if (!imageFormatFromName(argv[++i], opt.format) || (opt.format != ImageFormat::PNG && opt.format != ImageFormat::PPM))
+				return false;
+			opt.formatSet = true;
+		}
+		else if (arg == "-c" && hasValue)
+			opt.table.columns = std::atoi(argv[++i]);
+		else if (arg == "-s" && hasValue)
+			opt.table.scale = std::atoi(argv[++i]);
+		else if (arg == "-p" && hasValue)
+		{
+			if (!parsePalette(argv[++i], opt.table))
+				return false;
+		}
+		else if (arg[0] != '-' && opt.input.empty())
+			opt.input = arg;
+		else
+			return false;
+	}
+	return !opt.input.empty();
+}
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	if (!parseArgs(argc, argv, opt))
+	{
+		usage();
+		return 2;
+	}
+
+	if (!opt.formatSet && !opt.output.empty())
+	{
+		std::string ext = fs::path(opt.output).extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+		ImageFormat format;
+		if (!ext.empty() && imageFormatFromName(ext.substr(1), format))
+		{
+			if (format != ImageFormat::PNG && format != ImageFormat::PPM)
+			{
+				fprintf(stderr, "error: %s pictures are not supported, use .png or .ppm\n", ext.c_str());
+				return 2;
+			}
+			opt.format = format;
+		}
+	}
+
+	fs::path input(opt.input);
+	if (opt.output.empty())
+		opt.output = (input.parent_path() / (input.stem().string() + "_table" + imageFormatExtension(opt.format))).string();
+
+	try
+	{
+		auto start = std::chrono::steady_clock::now();
+		Font font = loadFont(opt.input);
+		FileWriter out(opt.output);
+		writeFontTableImage(out, font, opt.table, opt.format);
+		out.Close();
+
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		printf("%s: %zu cells, %llu bytes, %.1f ms\n", opt.output.c_str(), font.CharCount(), (unsigned long long)out.GetWritten(), ms);
+		return 0;
+	}
+	catch (const std::exception& ex)
+	{
+		fprintf(stderr, "error: %s\n", ex.what());
+		return 1;
+	}
+}
\ No newline at end of file